@@ -8,13 +8,15 @@
 #include <thread>
 #include <chrono>
 #include <algorithm>
-#include <regex>
 #include <curl/curl.h>
 #include <nlohmann/json.hpp>
 #include <fstream>
 #include <sstream>
 #include <iomanip>
 
+#include "../src/net/url.h"
+#include "../src/text/page_extractor.h"
+
 using namespace std;
 using json = nlohmann::json;
 
@@ -119,181 +121,78 @@ public:
     }
 };
 
-// HTML Parser with semantic extraction
+// HTML Parser with semantic extraction: a view of the ExtractedPage
+// that one PageExtractor pass fills in the constructor
 class HTMLParser {
 private:
-    string html_;
     string base_url_;
-    regex tag_regex_;
-    regex entity_regex_;
-    
-    string cleanText(const string& text) {
-        string cleaned = text;
-        
-        // Remove control characters except newlines and tabs
-        cleaned.erase(remove_if(cleaned.begin(), cleaned.end(),
-            [](char c) { return c < 32 && c != '\n' && c != '\t'; }), cleaned.end());
-        
-        // Normalize whitespace
-        regex whitespace_regex("\\s+");
-        cleaned = regex_replace(cleaned, whitespace_regex, " ");
-        
-        return cleaned;
-    }
+    ExtractedPage page_;
     
-    string extractMetaContent(const string& name) {
-        regex meta_regex("<meta[^>]*name=[\"']" + name + "[\"'][^>]*content=[\"']([^\"']*)[\"'][^>]*>", regex::icase);
-        smatch match;
-        if (regex_search(html_, match, meta_regex)) {
-            return decodeHTMLEntities(match[1].str());
-        }
-        return "";
+    static PageExtractor& extractor() {
+        thread_local PageExtractor extractor;
+        return extractor;
     }
     
-    string extractOpenGraphContent(const string& property) {
-        regex og_regex("<meta[^>]*property=[\"']og:" + property + "[\"'][^>]*content=[\"']([^\"']*)[\"'][^>]*>", regex::icase);
-        smatch match;
-        if (regex_search(html_, match, og_regex)) {
-            return decodeHTMLEntities(match[1].str());
+    // Links resolve against <base href>, else the page URL
+    string base() const {
+        string base;
+        if (page_.base_href.empty() || !Url::resolve(base_url_, page_.base_href, base)) {
+            base = base_url_;
         }
-        return "";
+        return base;
     }
 
 public:
-    AdvancedHTMLParser(const string& html, const string& base_url = "") 
-        : html_(html), base_url_(base_url), 
-          tag_regex_("<[^>]*>"), 
-          entity_regex_("&[a-zA-Z0-9#]+;") {}
+    HTMLParser(const string& html, const string& base_url = "") 
+        : base_url_(base_url) {
+        extractor().extract(html, page_);
+    }
     
     string extractTitle() {
-        // Try multiple title extraction methods
-        vector<string> title_selectors = {
-            "<title[^>]*>([^<]*)</title>",
-            "<h1[^>]*>([^<]*)</h1>",
-            "<meta[^>]*property=[\"']og:title[\"'][^>]*content=[\"']([^\"']*)[\"'][^>]*>",
-            "<meta[^>]*name=[\"']title[\"'][^>]*content=[\"']([^\"']*)[\"'][^>]*>"
-        };
-        
-        for (const auto& selector : title_selectors) {
-            regex title_regex(selector, regex::icase);
-            smatch match;
-            if (regex_search(html_, match, title_regex)) {
-                string title = decodeHTMLEntities(match[1].str());
-                if (!title.empty()) {
-                    return cleanText(title);
-                }
-            }
-        }
-        
-        return "";
+        return page_.title;
     }
     
     string extractDescription() {
-        string description = extractMetaContent("description");
-        if (description.empty()) {
-            description = extractOpenGraphContent("description");
-        }
-        if (description.empty()) {
-            // Extract from first paragraph
-            regex p_regex("<p[^>]*>([^<]*)</p>", regex::icase);
-            smatch match;
-            if (regex_search(html_, match, p_regex)) {
-                description = decodeHTMLEntities(match[1].str());
-            }
-        }
-        return cleanText(description);
+        return page_.description;
     }
     
     string extractMainContent() {
-        // Advanced content extraction with multiple strategies
-        vector<string> content_selectors = {
-            "<main[^>]*>([\\s\\S]*?)</main>",
-            "<article[^>]*>([\\s\\S]*?)</article>",
-            "<div[^>]*class=[\"'][^\"']*content[^\"']*[\"'][^>]*>([\\s\\S]*?)</div>",
-            "<div[^>]*id=[\"']content[\"'][^>]*>([\\s\\S]*?)</div>",
-            "<body[^>]*>([\\s\\S]*?)</body>"
-        };
-        
-        for (const auto& selector : content_selectors) {
-            regex content_regex(selector, regex::icase);
-            smatch match;
-            if (regex_search(html_, match, content_regex)) {
-                string content = match[1].str();
-                
-                // Remove script and style tags
-                content = regex_replace(content, regex("<script[^>]*>[\\s\\S]*?</script>", regex::icase), "");
-                content = regex_replace(content, regex("<style[^>]*>[\\s\\S]*?</style>", regex::icase), "");
-                
-                // Remove HTML tags
-                content = regex_replace(content, tag_regex_, " ");
-                
-                return cleanText(content);
-            }
-        }
-        
-        return "";
+        return string(page_.mainContent());
     }
     
     vector<string> extractLinks() {
         vector<string> links;
-        regex link_regex("<a[^>]*href=[\"']([^\"']*)[\"'][^>]*>", regex::icase);
-        
-        auto begin = sregex_iterator(html_.begin(), html_.end(), link_regex);
-        auto end = sregex_iterator();
-        
-        for (sregex_iterator i = begin; i != end; ++i) {
-            smatch match = *i;
-            string href = match[1].str();
-            
-            // Convert relative URLs to absolute
-            if (href.starts_with("/") && !base_url_.empty()) {
-                href = base_url_ + href;
-            } else if (!href.starts_with("http")) {
-                continue; // Skip non-http links
-            }
-            
-            links.push_back(href);
+        links.reserve(page_.links.size());
+        string base_url = base();
+        string url;
+        for (const auto& link : page_.links) {
+            if (Url::resolve(base_url, page_.url(link), url)) links.push_back(url);
         }
-        
         return links;
     }
     
     map<string, string> extractMetadata() {
         map<string, string> metadata;
         
-        metadata["title"] = extractTitle();
-        metadata["description"] = extractDescription();
-        metadata["keywords"] = extractMetaContent("keywords");
-        metadata["author"] = extractMetaContent("author");
-        metadata["language"] = extractMetaContent("language");
-        metadata["robots"] = extractMetaContent("robots");
+        metadata["title"] = page_.title;
+        metadata["description"] = page_.description;
+        metadata["keywords"] = page_.keywords;
+        metadata["author"] = page_.author;
+        metadata["language"] = page_.language;
+        metadata["robots"] = page_.robots;
         
         // Open Graph metadata
-        metadata["og_title"] = extractOpenGraphContent("title");
-        metadata["og_description"] = extractOpenGraphContent("description");
-        metadata["og_type"] = extractOpenGraphContent("type");
-        metadata["og_image"] = extractOpenGraphContent("image");
+        metadata["og_title"] = page_.og_title;
+        metadata["og_description"] = page_.og_description;
+        metadata["og_type"] = page_.og_type;
+        metadata["og_image"] = page_.og_image;
         
         return metadata;
     }
-
-private:
-    string decodeHTMLEntities(const string& text) {
-        string decoded = text;
-        
-        // Common HTML entities
-        map<string, string> entities = {
-            {"&amp;", "&"}, {"&lt;", "<"}, {"&gt;", ">"}, {"&quot;", "\""},
-            {"&#39;", "'"}, {"&nbsp;", " "}, {"&copy;", "©"}, {"&reg;", "®"}
-        };
-        
-        for (const auto& entity : entities) {
-            regex entity_regex(entity.first);
-            decoded = regex_replace(decoded, entity_regex, entity.second);
-        }
-        
-        return decoded;
-    }
+    
+    bool hasCodeBlocks() const { return page_.has_code_blocks; }
+    bool hasImages() const { return page_.has_images; }
+    bool hasVideos() const { return page_.has_videos; }
 };
 
 // Search Result with semantic analysis
@@ -572,11 +471,10 @@ public:
                 result.subjects = extractSubjects(result);
                 result.word_count = splitString(result.content, " ").size();
                 result.readability_score = calculateReadability(result.content);
-                result.has_code_blocks = result.content.find("```") != string::npos || 
-                                        result.content.find("<code>") != string::npos;
-                result.has_images = response.body.find("<img") != string::npos;
-                result.has_videos = response.body.find("<video") != string::npos || 
-                                   response.body.find("youtube.com") != string::npos;
+                result.has_code_blocks = parser.hasCodeBlocks() ||
+                                        result.content.find("```") != string::npos;
+                result.has_images = parser.hasImages();
+                result.has_videos = parser.hasVideos();
                 
                 // Categorize
                 result.category = categorizeUrl(url);
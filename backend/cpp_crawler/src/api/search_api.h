@@ -2,7 +2,11 @@
 
 #include "../net/http_server.h"
 #include "../search_engine.h"
+#include "../search/index_warmer.h"
+#include <atomic>
+#include <mutex>
 #include <sstream>
+#include <thread>
 
 class SearchApi {
 public:
@@ -16,16 +20,241 @@ public:
         server_.addRoute("/crawl", [this](auto&& headers, auto&& body) {
             return handleCrawl(headers, body);
         });
+        
+        server_.addRoute("/health", [this](auto&& headers, auto&& body) {
+            return handleHealth(headers, body);
+        });
+        
+        server_.addRoute("/admin/swap", [this](auto&& headers, auto&& body) {
+            return handleSwap(headers, body);
+        });
+        
+        server_.addRoute("/admin/index", [this](auto&& headers, auto&& body) {
+            return handleIndexStatus(headers, body);
+        });
+    }
+    
+    ~SearchApi() {
+        std::thread background;
+        {
+            std::lock_guard<std::mutex> lock(swap_mutex_);
+            background = std::move(swap_thread_);
+        }
+        if (background.joinable()) {
+            background.join();
+        }
     }
     
+    // With warm-up queries set, /health answers 503 until the served
+    // snapshot has been warmed with them
     void start() {
+        {
+            std::lock_guard<std::mutex> lock(swap_mutex_);
+            auto snapshot = engine_.getSnapshot();
+            if (snapshot && !warmup_queries_.empty()) {
+                ready_ = false;
+                swapping_ = true;
+                swap_thread_ = std::thread([this, snapshot, queries = warmup_queries_,
+                                            options = warmup_options_] {
+                    auto report = IndexWarmer::warm(*snapshot, queries, options);
+                    std::lock_guard<std::mutex> lock(swap_mutex_);
+                    last_warmup_ = report;
+                    swapping_ = false;
+                    ready_ = true;
+                });
+            }
+        }
         server_.start();
     }
     
+    // Queries replayed against every index before it serves: at start()
+    // and on each swap that asks for prefaulting. Typically the top
+    // queries from SearchAnalytics (IndexWarmer::topQueries).
+    void setWarmup(std::vector<std::string> queries, const IndexWarmer::Options& options) {
+        std::lock_guard<std::mutex> lock(swap_mutex_);
+        warmup_queries_ = std::move(queries);
+        warmup_options_ = options;
+    }
+    
+    // Admin routes answer only requests carrying this X-Admin-Token; they
+    // are disabled while it is empty
+    void setAdminToken(const std::string& token) {
+        std::lock_guard<std::mutex> lock(swap_mutex_);
+        admin_token_ = token;
+    }
+    
 private:
     SearchEngine& engine_;
     HttpServer server_;
     
+    std::mutex swap_mutex_;
+    std::thread swap_thread_;
+    bool swapping_ = false;
+    std::string admin_token_;
+    std::string last_swap_error_;
+    std::atomic<bool> ready_{true};
+    std::vector<std::string> warmup_queries_;
+    IndexWarmer::Options warmup_options_;
+    IndexWarmer::Report last_warmup_;
+    
+    static std::string formValue(const std::string& body, const std::string& key) {
+        size_t pos = 0;
+        while (pos < body.size()) {
+            size_t end = body.find('&', pos);
+            if (end == std::string::npos) end = body.size();
+            if (body.compare(pos, key.size() + 1, key + "=") == 0) {
+                return formDecode(body.substr(pos + key.size() + 1, end - pos - key.size() - 1));
+            }
+            pos = end + 1;
+        }
+        return "";
+    }
+    
+    // application/x-www-form-urlencoded: '+' is a space and %XX a byte;
+    // a '%' not followed by two hex digits is kept as is
+    static std::string formDecode(const std::string& value) {
+        auto hex = [](char c) {
+            if (c >= '0' && c <= '9') return c - '0';
+            if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+            if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+            return -1;
+        };
+        std::string out;
+        out.reserve(value.size());
+        for (size_t i = 0; i < value.size(); ++i) {
+            if (value[i] == '+') {
+                out += ' ';
+            } else if (value[i] == '%' && i + 2 < value.size() &&
+                       hex(value[i + 1]) >= 0 && hex(value[i + 2]) >= 0) {
+                out += static_cast<char>(hex(value[i + 1]) << 4 | hex(value[i + 2]));
+                i += 2;
+            } else {
+                out += value[i];
+            }
+        }
+        return out;
+    }
+    
+    static std::string jsonEscape(const std::string& text) {
+        static const char kHex[] = "0123456789abcdef";
+        std::string out;
+        out.reserve(text.size());
+        for (char c : text) {
+            auto u = static_cast<unsigned char>(c);
+            if (c == '"' || c == '\\') {
+                out += '\\';
+                out += c;
+            } else if (u < 0x20) {
+                out += "\\u00";
+                out += kHex[u >> 4];
+                out += kHex[u & 15];
+            } else {
+                out += c;
+            }
+        }
+        return out;
+    }
+    
+    bool authorized(const HttpServer::Headers& headers) {
+        auto it = headers.find("X-Admin-Token");
+        return !admin_token_.empty() && it != headers.end() && it->second == admin_token_;
+    }
+    
+    // Loads path=<index dir> on a background thread, optionally faulting
+    // in its hot pages and replaying the warm-up queries (prefault=1),
+    // then swaps it in. The directory must hold a single segment, as
+    // bulk_indexer writes; multi-segment IndexManager directories fail
+    // and the error shows in /admin/index. Queries never wait: running
+    // ones finish on the old snapshot, which is unmapped in the
+    // background once the last of them lets go. A holder that never lets
+    // go keeps it mapped (see open_snapshots) but does not block swaps.
+    std::string handleSwap(const HttpServer::Headers& headers,
+                          const std::string& body) {
+        std::lock_guard<std::mutex> lock(swap_mutex_);
+        if (!authorized(headers)) {
+            return "HTTP/1.1 403 Forbidden\r\n\r\nAdmin token required";
+        }
+        
+        std::string path = formValue(body, "path");
+        if (path.empty()) {
+            return "HTTP/1.1 400 Bad Request\r\n\r\nMissing path";
+        }
+        if (swapping_) {
+            return "HTTP/1.1 409 Conflict\r\n\r\nAn index swap is already in progress";
+        }
+        
+        bool prefault = formValue(body, "prefault") == "1";
+        if (swap_thread_.joinable()) {
+            swap_thread_.join();
+        }
+        swapping_ = true;
+        last_swap_error_.clear();
+        std::vector<std::string> queries = prefault ? warmup_queries_ : std::vector<std::string>();
+        swap_thread_ = std::thread(&SearchApi::swapIndex, this, path, prefault,
+                                   std::move(queries), warmup_options_);
+        return "HTTP/1.1 202 Accepted\r\n\r\nLoading " + path;
+    }
+    
+    void swapIndex(const std::string& path, bool prefault,
+                   const std::vector<std::string>& queries, const IndexWarmer::Options& options) {
+        std::string error;
+        IndexWarmer::Report report;
+        try {
+            auto next = IndexSnapshot::open(path, prefault, engine_.analyzer());
+            if (!queries.empty()) {
+                report = IndexWarmer::warm(*next, queries, options);
+            }
+            engine_.swapSnapshot(std::move(next));
+        } catch (const std::exception& e) {
+            error = e.what();
+        }
+        
+        std::lock_guard<std::mutex> lock(swap_mutex_);
+        last_swap_error_ = error;
+        if (!queries.empty() && error.empty()) {
+            last_warmup_ = report;
+        }
+        swapping_ = false;
+    }
+    
+    std::string handleHealth(const HttpServer::Headers& /*headers*/,
+                             const std::string& /*body*/) {
+        if (!ready_) {
+            return "HTTP/1.1 503 Service Unavailable\r\n\r\nWarming up";
+        }
+        return "HTTP/1.1 200 OK\r\n\r\nOK";
+    }
+    
+    std::string handleIndexStatus(const HttpServer::Headers& headers,
+                                  const std::string& /*body*/) {
+        std::lock_guard<std::mutex> lock(swap_mutex_);
+        if (!authorized(headers)) {
+            return "HTTP/1.1 403 Forbidden\r\n\r\nAdmin token required";
+        }
+        
+        std::ostringstream response;
+        response << "HTTP/1.1 200 OK\r\n"
+                << "Content-Type: application/json\r\n"
+                << "\r\n{";
+        if (auto snapshot = engine_.getSnapshot()) {
+            response << "\"version\":" << snapshot->version()
+                     << ",\"path\":\"" << jsonEscape(snapshot->path()) << "\""
+                     << ",\"documents\":" << snapshot->documentCount()
+                     << ",\"mapped_bytes\":" << snapshot->mappedBytes()
+                     << ",\"prefaulted_bytes\":" << snapshot->prefaultedBytes() << ",";
+        }
+        response << "\"warmup\":{\"queries\":" << last_warmup_.queries_replayed
+                 << ",\"terms_advised\":" << last_warmup_.terms_advised
+                 << ",\"seconds\":" << last_warmup_.seconds
+                 << ",\"budget_exhausted\":" << (last_warmup_.budget_exhausted ? "true" : "false")
+                 << "},";
+        response << "\"open_snapshots\":" << IndexSnapshot::liveCount() << ",";
+        response << "\"ready\":" << (ready_ ? "true" : "false")
+                 << ",\"swapping\":" << (swapping_ ? "true" : "false")
+                 << ",\"last_error\":\"" << jsonEscape(last_swap_error_) << "\"}";
+        return response.str();
+    }
+    
     std::string handleSearch(const HttpServer::Headers& headers, 
                            const std::string& body) {
         auto query_pos = body.find("query=");
@@ -1,7 +1,8 @@
 #pragma once
 
 #include "../net/http_client.h"
-#include "../text/parser.h"
+#include "../net/url.h"
+#include "../text/page_extractor.h"
 #include <queue>
 #include <unordered_set>
 #include <thread>
@@ -9,12 +10,15 @@
 
 class Crawler {
 public:
-    Crawler(size_t max_pages = 1000) : max_pages_(max_pages) {}
+    explicit Crawler(size_t max_pages = 1000, const Analyzer& analyzer = Analyzer())
+        : max_pages_(max_pages), analyzer_(analyzer) {}
     
     void start(const std::vector<std::string>& seed_urls) {
         for (const auto& url : seed_urls) {
-            frontier_.push(url);
-            discovered_.insert(url);
+            std::string canonical = Url::canonicalize(url);
+            if (!canonical.empty() && discovered_.insert(canonical).second) {
+                frontier_.push(canonical);
+            }
         }
         
         std::vector<std::thread> workers;
@@ -34,8 +38,13 @@ private:
     std::mutex discovered_mutex_;
     size_t max_pages_;
     size_t crawled_count_ = 0;
+    Analyzer analyzer_;
     
     void workerThread() {
+        // Reused across this worker's pages
+        PageExtractor extractor(analyzer_);
+        ExtractedPage page;
+        
         while (true) {
             std::string url;
             
@@ -52,7 +61,7 @@ private:
             try {
                 auto response = HttpClient::get(url);
                 if (response.status_code == 200) {
-                    processPage(url, response.body);
+                    processPage(url, response.body, extractor, page);
                 }
             } catch (const std::exception& e) {
                 // Log error
@@ -60,34 +69,38 @@ private:
         }
     }
     
-    void processPage(const std::string& url, const std::string& content) {
-        // Extract links
-        auto links = TextParser::extractLinks(content);
+    void processPage(const std::string& url, const std::string& content,
+                     PageExtractor& extractor, ExtractedPage& page) {
+        // Title, links and analyzed terms in one pass over the HTML
+        extractor.extract(content, page);
         
-        // Add to frontier
-        std::lock_guard<std::mutex> lock1(queue_mutex_);
-        std::lock_guard<std::mutex> lock2(discovered_mutex_);
+        // Resolve and canonicalize links before taking the locks; the
+        // strings are reused from page to page
+        thread_local std::string base;
+        thread_local std::vector<std::string> links;
+        if (page.base_href.empty() || !Url::resolve(url, page.base_href, base)) {
+            base = url;
+        }
+        size_t link_count = 0;
+        for (const auto& link : page.links) {
+            if (link_count == links.size()) links.emplace_back();
+            if (Url::resolve(base, page.url(link), links[link_count])) link_count++;
+        }
         
-        for (const auto& link : links) {
-            if (discovered_.find(link) == discovered_.end()) {
-                frontier_.push(link);
-                discovered_.insert(link);
+        // Add to frontier
+        {
+            std::lock_guard<std::mutex> lock1(queue_mutex_);
+            std::lock_guard<std::mutex> lock2(discovered_mutex_);
+            
+            for (size_t i = 0; i < link_count; ++i) {
+                if (discovered_.insert(links[i]).second) {
+                    frontier_.push(links[i]);
+                }
             }
         }
         
-        // Index page (would call indexer in real implementation)
-        auto tokens = TextParser::tokenize(content);
-        // indexer.addDocument({url, extractTitle(content), tokens});
-    }
-    
-    std::string extractTitle(const std::string& html) {
-        size_t title_start = html.find("<title>");
-        if (title_start == std::string::npos) return "";
-        
-        title_start += 7;
-        size_t title_end = html.find("</title>", title_start);
-        if (title_end == std::string::npos) return "";
-        
-        return html.substr(title_start, title_end - title_start);
+        // Index page (would call indexer in real implementation); the
+        // terms went through the same analyzer as the queries
+        // indexer.addDocument({url, page.title, page.tokens});
     }
 }; 
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include "api/search_api.h"
+#include "analytics/search_analytics.h"
 #include "search_engine.h"
 #include "utils/logger.h"
+#include <cstdlib>
 #include <iostream>
 
 int main() {
@@ -8,13 +10,34 @@ int main() {
         Logger::init("zeppa.log");
         Logger::info("Starting Zeppa Search Engine");
         
-        SearchEngine engine;
+        // Analysis settings (stopwords, stemming) must match the served index
+        Analyzer analyzer;
+        if (const char* config_path = std::getenv("ZEPPA_CONFIG")) {
+            analyzer = Analyzer(ConfigManager(config_path));
+        }
+        SearchEngine engine(analyzer);
         SearchApi api(engine, 8080);
+        if (const char* token = std::getenv("ZEPPA_ADMIN_TOKEN")) {
+            api.setAdminToken(token);
+        }
+        
+        // Serve a prebuilt index, warmed with the queries users ran most
+        if (const char* index_dir = std::getenv("ZEPPA_INDEX_DIR")) {
+            engine.swapSnapshot(IndexSnapshot::open(index_dir, true, engine.analyzer()));
+            if (const char* analytics_path = std::getenv("ZEPPA_ANALYTICS")) {
+                SearchAnalytics analytics;
+                analytics.loadAnalytics(analytics_path);
+                api.setWarmup(IndexWarmer::topQueries(analytics, 1000), IndexWarmer::Options());
+            }
+        }
         
         std::cout << "Starting Zeppa Search Engine on http://localhost:8080\n";
         std::cout << "Available endpoints:\n";
         std::cout << "  GET /search?query=<search_term> - Search for documents\n";
         std::cout << "  POST /crawl - Start crawling process\n";
+        std::cout << "  POST /admin/swap path=<index_dir>[&prefault=1] - Hot-swap the served index\n";
+        std::cout << "  GET /admin/index - Served index status\n";
+        std::cout << "  GET /health - 503 until warm-up completes\n";
         
         api.start();
         
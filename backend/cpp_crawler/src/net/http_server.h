@@ -9,8 +9,9 @@
 
 class HttpServer {
 public:
+    using Headers = std::unordered_map<std::string, std::string>;
     using Handler = std::function<std::string(
-        const std::unordered_map<std::string, std::string>& headers,
+        const Headers& headers,
         const std::string& body
     )>;
 
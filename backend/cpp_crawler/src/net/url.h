@@ -0,0 +1,406 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// RFC 3986 reference resolution and URL canonicalization for the crawler,
+// so that every spelling of a page maps to one string:
+//
+//   - scheme and host lowercased, userinfo and default ports dropped
+//   - "." and ".." path segments removed, an empty path made "/"
+//   - percent-encoding normalized: unreserved characters decoded, hex
+//     digits uppercased, bytes that may not appear in a URL encoded
+//   - fragment dropped
+//   - tracking parameters (utm_*, gclid, fbclid, ...) dropped from the
+//     query and the rest sorted by name
+//
+// Only http and https URLs are accepted. Results are written to a caller
+// buffer, so a crawler resolving link after link into the same string
+// does not allocate.
+//
+//     std::string link;
+//     if (Url::resolve("http://Example.com:80/a/b", "../c?utm_source=x#top", link)) {
+//         // link == "http://example.com/c"
+//     }
+class Url {
+public:
+    // Resolves reference against base, an absolute URL, and writes the
+    // canonical result to out. Returns false, leaving out unspecified,
+    // if the result is not an http(s) URL with a host; a relative
+    // reference needs a valid base.
+    static bool resolve(std::string_view base, std::string_view reference, std::string& out) {
+        Parts ref = split(trim(reference));
+        if (ref.has_scheme) return build(ref, ref.path, out);
+
+        Parts b = split(trim(base));
+        if (!b.has_scheme) return false;
+        if (ref.has_authority) {
+            // Network-path reference: "//host/path"
+            ref.scheme = b.scheme;
+            ref.has_scheme = true;
+            return build(ref, ref.path, out);
+        }
+
+        Parts target = b;
+        target.fragment = {};
+        if (ref.path.empty()) {
+            if (ref.has_query) {
+                target.query = ref.query;
+                target.has_query = true;
+            }
+            return build(target, target.path, out);
+        }
+        target.query = ref.query;
+        target.has_query = ref.has_query;
+        if (ref.path[0] == '/') return build(target, ref.path, out);
+
+        // Merge: the reference replaces the base path's last segment
+        size_t slash = b.path.rfind('/');
+        std::string_view directory = slash == std::string_view::npos ? std::string_view("/")
+                                                                     : b.path.substr(0, slash + 1);
+        return build(target, directory, out, ref.path);
+    }
+
+    // Canonical form of an absolute URL
+    static bool canonicalize(std::string_view url, std::string& out) {
+        return resolve({}, url, out);
+    }
+
+    static std::string canonicalize(std::string_view url) {
+        std::string out;
+        return canonicalize(url, out) ? out : std::string();
+    }
+
+    // Query parameters dropped by canonicalization: they identify a
+    // campaign or click, not a page
+    static bool isTrackingParameter(std::string_view name) {
+        static const char* const kTracking[] = {
+            "_ga", "_gl", "dclid", "fbclid", "gbraid", "gclid", "igshid", "mc_cid", "mc_eid",
+            "msclkid", "wbraid", "yclid"
+        };
+        if (name.empty()) return false;
+        switch (toLower(name[0])) {
+            case '_': case 'd': case 'f': case 'g': case 'i': case 'm': case 'u': case 'w': case 'y':
+                break;
+            default:
+                return false;
+        }
+        if (name.size() > 4 && equalsNoCase(name.substr(0, 4), "utm_")) return true;
+        for (const char* tracking : kTracking) {
+            if (equalsNoCase(name, tracking)) return true;
+        }
+        return false;
+    }
+
+private:
+    // Components per RFC 3986 appendix B; views into the input
+    struct Parts {
+        std::string_view scheme;
+        std::string_view authority;
+        std::string_view path;
+        std::string_view query;
+        std::string_view fragment;
+        bool has_scheme = false;
+        bool has_authority = false;
+        bool has_query = false;
+    };
+
+    static Parts split(std::string_view url) {
+        Parts parts;
+        size_t pos = 0;
+        if (!url.empty() && isSchemeStart(url[0])) {
+            size_t colon = 1;
+            while (colon < url.size() && isSchemeChar(url[colon])) colon++;
+            if (colon < url.size() && url[colon] == ':') {
+                parts.scheme = url.substr(0, colon);
+                parts.has_scheme = true;
+                pos = colon + 1;
+            }
+        }
+        if (url.compare(pos, 2, "//") == 0) {
+            size_t end = findDelimiter(url, pos + 2, kSlash | kQuestion | kHash);
+            parts.authority = url.substr(pos + 2, end - pos - 2);
+            parts.has_authority = true;
+            pos = end;
+        }
+        size_t end = findDelimiter(url, pos, kQuestion | kHash);
+        parts.path = url.substr(pos, end - pos);
+        pos = end;
+        if (pos < url.size() && url[pos] == '?') {
+            end = findDelimiter(url, pos, kHash);
+            parts.query = url.substr(pos + 1, end - pos - 1);
+            parts.has_query = true;
+            pos = end;
+        }
+        if (pos < url.size()) parts.fragment = url.substr(pos + 1);
+        return parts;
+    }
+
+    enum Delimiter : uint8_t { kSlash = 1, kQuestion = 2, kHash = 4 };
+
+    // Position of the first delimiter in the set at or after pos, else
+    // text.size()
+    static size_t findDelimiter(std::string_view text, size_t pos, uint8_t delimiters) {
+        static const std::array<uint8_t, 256> kDelimiters = [] {
+            std::array<uint8_t, 256> table{};
+            table['/'] = kSlash;
+            table['?'] = kQuestion;
+            table['#'] = kHash;
+            return table;
+        }();
+        while (pos < text.size() && !(kDelimiters[static_cast<unsigned char>(text[pos])] & delimiters)) pos++;
+        return pos;
+    }
+
+    // Writes the canonical URL for parts, with path = directory + relative
+    static bool build(const Parts& parts, std::string_view directory, std::string& out,
+                      std::string_view relative = {}) {
+        out.clear();
+        bool https;
+        if (equalsNoCase(parts.scheme, "http")) {
+            https = false;
+        } else if (equalsNoCase(parts.scheme, "https")) {
+            https = true;
+        } else {
+            return false;
+        }
+        out += https ? "https://" : "http://";
+        if (!parts.has_authority || !appendAuthority(parts.authority, https, out)) return false;
+
+        // With an authority, a path is empty or starts with "/"
+        size_t path_start = out.size();
+        appendEncoded(directory, out);
+        appendEncoded(relative, out);
+        removeDotSegments(out, path_start);
+        if (out.size() == path_start) out += '/';
+
+        if (parts.has_query) appendQuery(parts.query, out);
+        return true;
+    }
+
+    // host[:port] lowercased, without userinfo or a default port
+    static bool appendAuthority(std::string_view authority, bool https, std::string& out) {
+        size_t at = authority.rfind('@');
+        if (at != std::string_view::npos) authority.remove_prefix(at + 1);
+
+        std::string_view host = authority;
+        std::string_view port;
+        size_t colon = authority.rfind(':');
+        // A colon inside an IPv6 literal is not a port separator
+        if (colon != std::string_view::npos && authority.find(']', colon) == std::string_view::npos) {
+            host = authority.substr(0, colon);
+            port = authority.substr(colon + 1);
+        }
+        if (!host.empty() && host.back() == '.') host.remove_suffix(1);
+        if (host.empty()) return false;
+        size_t start = out.size();
+        out += host;
+        for (size_t i = start; i < out.size(); ++i) {
+            char c = out[i];
+            if (static_cast<unsigned char>(c) <= ' ' || c == '\\' || c == '@' || c == '<' || c == '>' ||
+                c == '"') {
+                return false;
+            }
+            out[i] = toLower(c);
+        }
+
+        for (char c : port) {
+            if (c < '0' || c > '9') return false;
+        }
+        while (port.size() > 1 && port[0] == '0') port.remove_prefix(1);
+        if (!port.empty() && port != (https ? "443" : "80")) {
+            out += ':';
+            out += port;
+        }
+        return true;
+    }
+
+    enum ByteClass : uint8_t { Copy, Encode, Percent, Drop };
+
+    static const std::array<uint8_t, 256>& byteClasses() {
+        static const std::array<uint8_t, 256> classes = [] {
+            std::array<uint8_t, 256> table{};
+            for (int c = 1; c < 256; ++c) {
+                if (c <= ' ' || c >= 0x7F || std::strchr("\"<>\\^`{|}", c)) table[c] = Encode;
+            }
+            table[0] = Encode;
+            table['%'] = Percent;
+            table['\t'] = table['\n'] = table['\r'] = Drop;
+            return table;
+        }();
+        return classes;
+    }
+
+    // Copies a path or query component with its percent-encoding
+    // normalized. Tabs and newlines are dropped, as browsers do.
+    static void appendEncoded(std::string_view text, std::string& out) {
+        static const char kHex[] = "0123456789ABCDEF";
+        const auto& classes = byteClasses();
+        size_t i = 0;
+        while (i < text.size()) {
+            // Most bytes are copied as they are, a run at a time
+            size_t run = i;
+            while (run < text.size() && classes[static_cast<unsigned char>(text[run])] == Copy) run++;
+            out.append(text.data() + i, run - i);
+            if (run == text.size()) break;
+
+            i = run;
+            auto c = static_cast<unsigned char>(text[i++]);
+            switch (classes[c]) {
+                case Percent: {
+                    int high = i + 1 < text.size() ? hexValue(text[i]) : -1;
+                    int low = high >= 0 ? hexValue(text[i + 1]) : -1;
+                    if (low < 0) {
+                        out += "%25";
+                        break;
+                    }
+                    auto decoded = static_cast<unsigned char>(high << 4 | low);
+                    if (isUnreserved(decoded)) {
+                        out += static_cast<char>(decoded);
+                    } else {
+                        char escape[] = {'%', kHex[high], kHex[low]};
+                        out.append(escape, 3);
+                    }
+                    i += 2;
+                    break;
+                }
+                case Encode: {
+                    char escape[] = {'%', kHex[c >> 4], kHex[c & 15]};
+                    out.append(escape, 3);
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+    }
+
+    // RFC 3986 5.2.4 over out[start..], in place: the path is rewritten
+    // segment by segment, never past the segment being read
+    static void removeDotSegments(std::string& out, size_t start) {
+        size_t dot = start;
+        while (dot + 1 < out.size() && !(out[dot] == '/' && out[dot + 1] == '.')) dot++;
+        if (dot + 1 >= out.size()) return;
+        size_t in = start;
+        size_t written = start;
+        size_t size = out.size();
+        char* path = out.data();
+        while (in < size) {
+            // Each step reads one "/segment"
+            size_t end = in + 1;
+            while (end < size && path[end] != '/') end++;
+            std::string_view segment(path + in + 1, end - in - 1);
+            bool last = end == size;
+            if (segment == "." || segment == "..") {
+                if (segment == "..") {
+                    while (written > start && path[--written] != '/') {}
+                }
+                if (last) path[written++] = '/';
+            } else {
+                std::memmove(path + written, path + in, end - in);
+                written += end - in;
+            }
+            in = end;
+        }
+        out.resize(written);
+    }
+
+    // "?" and the parameters that are not tracking parameters, sorted by
+    // name; equal names keep their order. Nothing if none are left.
+    static void appendQuery(std::string_view query, std::string& out) {
+        size_t start = out.size();
+        out += '?';
+        appendEncoded(query, out);
+
+        // Most queries are canonical already and stay as written
+        bool canonical = true;
+        std::string_view previous;
+        std::string_view rest = std::string_view(out).substr(start + 1);
+        while (canonical) {
+            size_t amp = rest.find('&');
+            std::string_view param = rest.substr(0, amp);
+            std::string_view name = param.substr(0, param.find('='));
+            canonical = !param.empty() && !isTrackingParameter(name) && previous <= name;
+            previous = name;
+            if (amp == std::string_view::npos) break;
+            rest.remove_prefix(amp + 1);
+        }
+        if (canonical) return;
+
+        thread_local std::string encoded;
+        thread_local std::vector<std::string_view> params;
+        encoded.assign(out, start + 1, std::string::npos);
+        out.resize(start);
+        params.clear();
+        rest = encoded;
+        while (!rest.empty()) {
+            size_t amp = std::min(rest.find('&'), rest.size());
+            std::string_view param = rest.substr(0, amp);
+            rest.remove_prefix(std::min(amp + 1, rest.size()));
+            if (!param.empty() && !isTrackingParameter(param.substr(0, param.find('=')))) {
+                params.push_back(param);
+            }
+        }
+        // Insertion sort: stable, and queries have few parameters
+        for (size_t i = 1; i < params.size(); ++i) {
+            std::string_view param = params[i];
+            std::string_view name = param.substr(0, param.find('='));
+            size_t j = i;
+            for (; j > 0 && name < params[j - 1].substr(0, params[j - 1].find('=')); --j) {
+                params[j] = params[j - 1];
+            }
+            params[j] = param;
+        }
+        char separator = '?';
+        for (std::string_view param : params) {
+            out += separator;
+            out += param;
+            separator = '&';
+        }
+    }
+
+    static std::string_view trim(std::string_view text) {
+        while (!text.empty() && static_cast<unsigned char>(text.front()) <= ' ') text.remove_prefix(1);
+        while (!text.empty() && static_cast<unsigned char>(text.back()) <= ' ') text.remove_suffix(1);
+        return text;
+    }
+
+    static char toLower(char c) {
+        return c >= 'A' && c <= 'Z' ? static_cast<char>(c + ('a' - 'A')) : c;
+    }
+
+    // Compares ASCII case-insensitively against a lowercase string
+    static bool equalsNoCase(std::string_view text, std::string_view lower) {
+        if (text.size() != lower.size()) return false;
+        for (size_t i = 0; i < text.size(); ++i) {
+            if (toLower(text[i]) != lower[i]) return false;
+        }
+        return true;
+    }
+
+    static bool isSchemeStart(char c) {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+    }
+
+    static bool isSchemeChar(char c) {
+        return isSchemeStart(c) || (c >= '0' && c <= '9') || c == '+' || c == '-' || c == '.';
+    }
+
+    static bool isUnreserved(unsigned char c) {
+        return isSchemeStart(static_cast<char>(c)) || (c >= '0' && c <= '9') ||
+               c == '-' || c == '.' || c == '_' || c == '~';
+    }
+
+    static int hexValue(char c) {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    }
+};
@@ -0,0 +1,283 @@
+#pragma once
+
+#include "inverted_index.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <future>
+#include <numeric>
+#include <thread>
+
+// Offline doc-id reassignment. Documents that share terms are given nearby
+// ids so posting lists have small d-gaps and compress better.
+//
+// GRAPH_BISECTION implements recursive graph bisection (BP) over the
+// document/term bipartite graph, seeded with URL-lexicographic order.
+// URL_ORDER only applies the seed ordering.
+class DocIdReorderer {
+public:
+    enum Strategy { URL_ORDER, GRAPH_BISECTION };
+
+    struct Options {
+        Strategy strategy = GRAPH_BISECTION;
+        size_t iterations = 20;
+        size_t leaf_size = 16;
+        size_t threads = std::max(1u, std::thread::hardware_concurrency());
+    };
+
+    struct Report {
+        size_t documents = 0;
+        size_t postings = 0;
+        double bits_before = 0.0;
+        double bits_after = 0.0;
+        double seconds = 0.0;
+    };
+
+    // Reorders a single segment in place and reports bits-per-posting.
+    static Report optimize(InvertedIndex& index) {
+        return optimize(index, Options());
+    }
+
+    static Report optimize(InvertedIndex& index, const Options& options) {
+        auto start = std::chrono::steady_clock::now();
+
+        // Tombstoned documents would otherwise be counted and reordered
+        index.compact();
+
+        Report report;
+        report.documents = index.getDocumentCount();
+        report.bits_before = bitsPerPosting(index, &report.postings);
+
+        auto order = computeOrder(index, options);
+
+        // Reuse the segment's existing id space so id ranges stay stable
+        std::vector<size_t> ids(order.begin(), order.end());
+        std::sort(ids.begin(), ids.end());
+
+        std::unordered_map<size_t, size_t> new_ids;
+        new_ids.reserve(order.size());
+        for (size_t i = 0; i < order.size(); ++i) {
+            new_ids[order[i]] = ids[i];
+        }
+        index.remapDocuments(new_ids);
+
+        report.bits_after = bitsPerPosting(index);
+        report.seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+        return report;
+    }
+
+    // Segments are independent, so each one is reordered on its own thread.
+    static std::vector<Report> optimize(const std::vector<InvertedIndex*>& segments,
+                                        const Options& options) {
+        std::vector<Report> reports(segments.size());
+        std::vector<std::future<void>> pending;
+
+        Options per_segment = options;
+        per_segment.threads = std::max<size_t>(1, options.threads / std::max<size_t>(1, segments.size()));
+
+        for (size_t i = 0; i < segments.size(); ++i) {
+            pending.push_back(std::async(std::launch::async, [&, i]() {
+                reports[i] = optimize(*segments[i], per_segment);
+            }));
+        }
+        for (auto& task : pending) {
+            task.get();
+        }
+        return reports;
+    }
+
+    // Returns the old document ids in their new order.
+    static std::vector<size_t> computeOrder(const InvertedIndex& index,
+                                            const Options& options) {
+        std::vector<const InvertedIndex::Document*> seed;
+        seed.reserve(index.getDocumentCount());
+        for (const auto& [id, doc] : index.getDocuments()) {
+            seed.push_back(&doc);
+        }
+        std::sort(seed.begin(), seed.end(),
+            [](const auto* a, const auto* b) {
+                return a->url != b->url ? a->url < b->url : a->id < b->id;
+            });
+
+        std::vector<size_t> order;
+        order.reserve(seed.size());
+        for (const auto* doc : seed) {
+            order.push_back(doc->id);
+        }
+
+        if (options.strategy == URL_ORDER || order.size() <= options.leaf_size) {
+            return order;
+        }
+
+        Graph graph = buildGraph(index, order);
+        std::vector<uint32_t> docs(order.size());
+        std::iota(docs.begin(), docs.end(), 0);
+
+        size_t parallel_depth = 0;
+        while ((size_t(1) << parallel_depth) < options.threads) {
+            parallel_depth++;
+        }
+        bisect(graph, docs.begin(), docs.end(), 0, parallel_depth, options);
+
+        std::vector<size_t> result;
+        result.reserve(docs.size());
+        for (uint32_t local : docs) {
+            result.push_back(order[local]);
+        }
+        return result;
+    }
+
+    // Average Elias-gamma cost of a d-gap, i.e. what a gap-coded posting
+    // costs in this ordering.
+    static double bitsPerPosting(const InvertedIndex& index, size_t* postings_out = nullptr) {
+        size_t min_id = SIZE_MAX;
+        for (const auto& [id, doc] : index.getDocuments()) {
+            min_id = std::min(min_id, id);
+        }
+
+        double bits = 0.0;
+        size_t postings = 0;
+        std::vector<size_t> ids;
+        for (const auto& [term, list] : index.getTerms()) {
+            ids.clear();
+            for (const auto& posting : list) {
+                ids.push_back(posting.doc_id);
+            }
+            std::sort(ids.begin(), ids.end());
+
+            size_t prev = min_id;
+            for (size_t id : ids) {
+                bits += gammaBits(id - prev + 1);
+                prev = id + 1;
+            }
+            postings += ids.size();
+        }
+
+        if (postings_out) *postings_out = postings;
+        return postings ? bits / postings : 0.0;
+    }
+
+private:
+    using DocIter = std::vector<uint32_t>::iterator;
+
+    struct Graph {
+        size_t num_terms = 0;
+        std::vector<std::vector<uint32_t>> doc_terms;
+    };
+
+    static double gammaBits(size_t gap) {
+        return 2.0 * std::floor(std::log2(static_cast<double>(gap))) + 1.0;
+    }
+
+    static Graph buildGraph(const InvertedIndex& index, const std::vector<size_t>& order) {
+        std::unordered_map<size_t, uint32_t> local;
+        local.reserve(order.size());
+        for (size_t i = 0; i < order.size(); ++i) {
+            local[order[i]] = static_cast<uint32_t>(i);
+        }
+
+        Graph graph;
+        graph.doc_terms.resize(order.size());
+        for (const auto& [term, postings] : index.getTerms()) {
+            // Terms in a single document cannot influence the partition
+            if (postings.size() < 2) continue;
+            uint32_t term_id = static_cast<uint32_t>(graph.num_terms++);
+            for (const auto& posting : postings) {
+                graph.doc_terms[local.at(posting.doc_id)].push_back(term_id);
+            }
+        }
+        return graph;
+    }
+
+    // Approximate log-gap cost of a term with `deg` documents in a part of `n`
+    static double cost(double deg, double n) {
+        return deg > 0 ? deg * std::log2(n / (deg + 1.0)) : 0.0;
+    }
+
+    static void bisect(const Graph& graph, DocIter begin, DocIter end, size_t depth,
+                       size_t parallel_depth, const Options& options) {
+        size_t n = static_cast<size_t>(end - begin);
+        if (n <= options.leaf_size) return;
+
+        DocIter mid = begin + n / 2;
+        partition(graph, begin, mid, end, options.iterations);
+
+        if (depth < parallel_depth) {
+            auto left = std::async(std::launch::async, [&]() {
+                bisect(graph, begin, mid, depth + 1, parallel_depth, options);
+            });
+            bisect(graph, mid, end, depth + 1, parallel_depth, options);
+            left.get();
+        } else {
+            bisect(graph, begin, mid, depth + 1, parallel_depth, options);
+            bisect(graph, mid, end, depth + 1, parallel_depth, options);
+        }
+    }
+
+    static void partition(const Graph& graph, DocIter begin, DocIter mid, DocIter end,
+                          size_t iterations) {
+        // Scratch degree arrays are per thread and only touched entries are reset
+        thread_local std::vector<uint32_t> left_deg;
+        thread_local std::vector<uint32_t> right_deg;
+        if (left_deg.size() < graph.num_terms) {
+            left_deg.assign(graph.num_terms, 0);
+            right_deg.assign(graph.num_terms, 0);
+        }
+
+        const double n_left = static_cast<double>(mid - begin);
+        const double n_right = static_cast<double>(end - mid);
+        std::vector<std::pair<double, uint32_t>> left_gains, right_gains;
+
+        auto gain = [&](uint32_t doc, bool from_left) {
+            double g = 0.0;
+            for (uint32_t t : graph.doc_terms[doc]) {
+                double dl = left_deg[t], dr = right_deg[t];
+                double before = cost(dl, n_left) + cost(dr, n_right);
+                double after = from_left
+                    ? cost(dl - 1, n_left) + cost(dr + 1, n_right)
+                    : cost(dl + 1, n_left) + cost(dr - 1, n_right);
+                g += before - after;
+            }
+            return g;
+        };
+
+        for (size_t iter = 0; iter < iterations; ++iter) {
+            for (DocIter it = begin; it != mid; ++it) {
+                for (uint32_t t : graph.doc_terms[*it]) left_deg[t]++;
+            }
+            for (DocIter it = mid; it != end; ++it) {
+                for (uint32_t t : graph.doc_terms[*it]) right_deg[t]++;
+            }
+
+            left_gains.clear();
+            right_gains.clear();
+            for (DocIter it = begin; it != mid; ++it) {
+                left_gains.push_back({gain(*it, true), static_cast<uint32_t>(it - begin)});
+            }
+            for (DocIter it = mid; it != end; ++it) {
+                right_gains.push_back({gain(*it, false), static_cast<uint32_t>(it - begin)});
+            }
+
+            for (DocIter it = begin; it != end; ++it) {
+                for (uint32_t t : graph.doc_terms[*it]) {
+                    left_deg[t] = 0;
+                    right_deg[t] = 0;
+                }
+            }
+
+            auto by_gain = [](const auto& a, const auto& b) { return a.first > b.first; };
+            std::sort(left_gains.begin(), left_gains.end(), by_gain);
+            std::sort(right_gains.begin(), right_gains.end(), by_gain);
+
+            size_t swaps = 0;
+            for (size_t i = 0; i < left_gains.size() && i < right_gains.size(); ++i) {
+                if (left_gains[i].first + right_gains[i].first <= 0.0) break;
+                std::iter_swap(begin + left_gains[i].second, begin + right_gains[i].second);
+                swaps++;
+            }
+            if (swaps == 0) break;
+        }
+    }
+};
@@ -0,0 +1,522 @@
+#include "index_manager.h"
+#include <algorithm>
+#include <filesystem>
+#include <stdexcept>
+
+namespace {
+
+// Without background merges, a checkpoint folds the segments into one
+// once there are this many
+constexpr size_t kMaxUnmergedSegments = 32;
+
+// A full dictionary interns new terms to kNoTerm, which the memtable
+// would drop; refuse the write instead of indexing part of a document
+void checkDictionary() {
+    if (TermDictionary::shared().full()) {
+        throw std::length_error("Term dictionary is full");
+    }
+}
+
+} // namespace
+
+IndexManager::IndexManager(const std::string& data_path, const Analyzer& analyzer)
+    : analyzer_(analyzer), index_(newMemtable()), disk_index_(data_path) {}
+
+IndexManager::~IndexManager() {
+    disablePostingTiering();
+    stopMerges();
+    stopMaintenance();
+}
+
+void IndexManager::addDocument(const InvertedIndex::Document& doc) {
+    checkDictionary();
+    std::lock_guard<std::mutex> lock(index_mutex_);
+    
+    // Re-adding a known URL replaces the stored copy
+    size_t existing = url_table_.find(doc.url);
+    if (existing != UrlTable::npos) {
+        removeLocked(existing);
+    }
+    addLocked(doc);
+    flushIfNeededLocked();
+}
+
+void IndexManager::removeDocument(const std::string& url) {
+    std::lock_guard<std::mutex> lock(index_mutex_);
+    
+    size_t id = url_table_.find(url);
+    if (id == UrlTable::npos) return;
+    
+    removeLocked(id);
+    url_table_.erase(url);
+}
+
+void IndexManager::updateDocument(const InvertedIndex::Document& doc) {
+    checkDictionary();
+    std::lock_guard<std::mutex> lock(index_mutex_);
+    
+    // The old id, if any, is tombstoned, so the new version gets a
+    // fresh one
+    size_t id = url_table_.find(doc.url);
+    if (id != UrlTable::npos) {
+        removeLocked(id);
+    }
+    addLocked(doc);
+    flushIfNeededLocked();
+}
+
+void IndexManager::applyBatch(std::vector<InvertedIndex::Document> upserts,
+                              const std::vector<std::string>& deletes) {
+    checkDictionary();
+    size_t first_id;
+    {
+        std::lock_guard<std::mutex> lock(index_mutex_);
+        first_id = next_doc_id_;
+        next_doc_id_ += upserts.size();
+    }
+    
+    // The documents are moved into the batch; only their URLs are still
+    // needed below
+    InvertedIndex batch;
+    batch.setAnalyzer(analyzer_);
+    std::vector<std::string> urls;
+    urls.reserve(upserts.size());
+    for (size_t i = 0; i < upserts.size(); ++i) {
+        upserts[i].id = first_id + i;
+        urls.push_back(upserts[i].url);
+        batch.addDocument(std::move(upserts[i]));
+    }
+    
+    std::lock_guard<std::mutex> lock(index_mutex_);
+    for (const auto& url : deletes) {
+        size_t id = url_table_.find(url);
+        if (id == UrlTable::npos) continue;
+        removeLocked(id);
+        url_table_.erase(url);
+    }
+    for (size_t i = 0; i < urls.size(); ++i) {
+        size_t existing = url_table_.find(urls[i]);
+        if (existing != UrlTable::npos) {
+            removeLocked(existing);
+        }
+        url_table_.insert(urls[i], first_id + i);
+    }
+    index_->merge(std::move(batch));
+    flushIfNeededLocked();
+}
+
+std::vector<InvertedIndex::Document> IndexManager::search(const std::string& query, size_t limit) {
+    auto started = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(index_mutex_);
+    
+    auto terms = analyzer_.analyze(query);
+    
+    // Segments are scored against collection-wide statistics so scores
+    // are comparable across them
+    size_t total_docs = index_->getDocumentCount();
+    for (const auto& segment : segments_) {
+        total_docs += segment->getDocumentCount();
+    }
+    
+    // The memtable is keyed by term id; the mapped segments by term bytes
+    const TermDictionary& dictionary = TermDictionary::shared();
+    std::unordered_map<size_t, double> scores;
+    for (const auto& term : terms) {
+        uint32_t id = dictionary.find(term);
+        size_t doc_freq = id != TermDictionary::kNoTerm ? index_->getDocumentFrequency(id) : 0;
+        for (const auto& segment : segments_) {
+            doc_freq += segment->getDocumentFrequency(term);
+        }
+        
+        double idf = Ranker::idf(total_docs, doc_freq);
+        if (id != TermDictionary::kNoTerm) {
+            Ranker::accumulate(id, idf, *index_, scores);
+        }
+        for (const auto& segment : segments_) {
+            Ranker::accumulate(term, idf, *segment, scores);
+        }
+    }
+    
+    auto results = Ranker::sortScores(scores);
+    if (results.size() > limit) {
+        results.resize(limit);
+    }
+    auto docs = processResults(results);
+    query_latency_.record(std::chrono::steady_clock::now() - started);
+    return docs;
+}
+
+void IndexManager::save() {
+    std::lock_guard<std::mutex> lock(index_mutex_);
+    saveLocked();
+}
+
+void IndexManager::load() {
+    std::lock_guard<std::mutex> lock(index_mutex_);
+    
+    // The saved segments are mapped, not deserialized
+    index_ = newMemtable();
+    merging_.clear();
+    segments_ = disk_index_.openAll();
+    
+    url_table_.clear();
+    next_doc_id_ = 0;
+    for (const auto& segment : segments_) {
+        for (size_t i = 0; i < segment->getStoredDocumentCount(); ++i) {
+            size_t id = segment->docIdAt(i);
+            next_doc_id_ = std::max(next_doc_id_, id + 1);
+            if (segment->isLive(id)) {
+                url_table_.insert(std::string(segment->urlAt(i)), id);
+            }
+        }
+    }
+    url_table_.compact();
+}
+
+void IndexManager::setCompactionPolicy(double deleted_ratio,
+                                       std::chrono::seconds check_interval) {
+    std::lock_guard<std::mutex> lock(maintenance_mutex_);
+    compaction_ratio_ = deleted_ratio;
+    compaction_interval_ = check_interval;
+}
+
+void IndexManager::startMaintenance() {
+    if (maintenance_running_.exchange(true)) return;
+    maintenance_thread_ = std::thread(&IndexManager::maintenanceLoop, this);
+}
+
+void IndexManager::stopMaintenance() {
+    if (!maintenance_running_.exchange(false)) return;
+    maintenance_cv_.notify_all();
+    if (maintenance_thread_.joinable()) {
+        maintenance_thread_.join();
+    }
+}
+
+bool IndexManager::compactIfNeeded() {
+    double threshold;
+    {
+        std::lock_guard<std::mutex> lock(maintenance_mutex_);
+        threshold = compaction_ratio_;
+    }
+    
+    std::shared_ptr<MappedSegment> input;
+    std::shared_ptr<MappedSegment> snapshot;
+    std::shared_ptr<IoThrottle> throttle;
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(index_mutex_);
+        
+        // Mapped segments are immutable; purging one means rewriting it,
+        // which is done like a merge of that segment alone
+        for (const auto& segment : segments_) {
+            if (segment->getDeletedRatio() >= threshold && !merging_.count(segment.get())) {
+                input = segment;
+                break;
+            }
+        }
+        
+        if (!input) {
+            if (index_->getDeletedRatio() < threshold) return false;
+            index_->compact();
+            return true;
+        }
+        
+        snapshot = input->snapshot();
+        merging_.insert(input.get());
+        path = disk_index_.newSegmentPath();
+        throttle = merge_scheduler_ ? merge_scheduler_->throttle()
+                                    : std::make_shared<IoThrottle>(merge_write_limit_.value_or(0));
+    }
+    
+    return rewriteSegments({input}, {snapshot}, path,
+                           [&throttle](size_t bytes) { throttle->acquire(bytes); }) != nullptr;
+}
+
+void IndexManager::maintenanceLoop() {
+    while (maintenance_running_) {
+        {
+            std::unique_lock<std::mutex> lock(maintenance_mutex_);
+            maintenance_cv_.wait_for(lock, compaction_interval_,
+                [this] { return !maintenance_running_; });
+        }
+        if (!maintenance_running_) break;
+        compactIfNeeded();
+    }
+}
+
+void IndexManager::saveLocked() {
+    if (merge_scheduler_ || segments_.size() < kMaxUnmergedSegments) {
+        // Only the memtable and the deletions since the last checkpoint
+        // are written
+        flushLocked();
+        disk_index_.commit(segments_);
+        return;
+    }
+    
+    // Everything now lives in one freshly written segment
+    auto merged = disk_index_.save(segments_, *index_);
+    for (const auto& segment : segments_) {
+        disk_index_.release(segment->path());
+    }
+    segments_ = {merged};
+    merging_.clear();
+    index_ = newMemtable();
+}
+
+std::unique_ptr<InvertedIndex> IndexManager::newMemtable() const {
+    auto memtable = std::make_unique<InvertedIndex>();
+    memtable->setAnalyzer(analyzer_);
+    return memtable;
+}
+
+void IndexManager::removeLocked(size_t id) {
+    if (index_->hasDocument(id)) {
+        index_->removeDocument(id);
+        return;
+    }
+    // Merged segments cover overlapping id ranges, so look the id up
+    for (const auto& segment : segments_) {
+        if (segment->hasDocument(id)) {
+            segment->removeDocument(id);
+            return;
+        }
+    }
+}
+
+void IndexManager::addLocked(InvertedIndex::Document doc) {
+    doc.id = next_doc_id_++;
+    url_table_.insert(doc.url, doc.id);
+    index_->addDocument(doc);
+}
+
+std::vector<InvertedIndex::Document> IndexManager::processResults(
+    const std::vector<Ranker::Result>& results) {
+    
+    std::vector<InvertedIndex::Document> docs;
+    docs.reserve(results.size());
+    for (const auto& result : results) {
+        if (index_->hasDocument(result.doc_id)) {
+            docs.push_back(index_->getDocument(result.doc_id));
+            continue;
+        }
+        for (const auto& segment : segments_) {
+            if (segment->hasDocument(result.doc_id)) {
+                docs.push_back(segment->getStoredDocument(result.doc_id));
+                break;
+            }
+        }
+    }
+    return docs;
+}
+
+void IndexManager::startMerges() {
+    startMerges(MergeScheduler::Options());
+}
+
+void IndexManager::startMerges(const MergeScheduler::Options& options) {
+    std::lock_guard<std::mutex> lock(index_mutex_);
+    if (merge_scheduler_) return;
+    MergeScheduler::Options effective = options;
+    if (merge_write_limit_) {
+        effective.max_write_bytes_per_sec = *merge_write_limit_;
+    }
+    merge_scheduler_ = std::make_unique<MergeScheduler>(
+        [this](const MergeScheduler::WriteHook& on_write) { return mergeOnce(on_write); }, effective);
+    if (merge_pause_predicate_) {
+        merge_scheduler_->setPausePredicate(merge_pause_predicate_);
+    }
+    merge_scheduler_->start();
+}
+
+void IndexManager::stopMerges() {
+    // Joined outside the lock: a merge commits under index_mutex_
+    std::unique_ptr<MergeScheduler> scheduler;
+    {
+        std::lock_guard<std::mutex> lock(index_mutex_);
+        scheduler = std::move(merge_scheduler_);
+    }
+    if (scheduler) {
+        scheduler->stop();
+    }
+}
+
+void IndexManager::setMergePolicy(const TieredMergePolicy& policy) {
+    std::lock_guard<std::mutex> lock(index_mutex_);
+    merge_policy_ = policy;
+}
+
+void IndexManager::setFlushThreshold(size_t documents) {
+    std::lock_guard<std::mutex> lock(index_mutex_);
+    flush_threshold_ = std::max<size_t>(1, documents);
+}
+
+void IndexManager::setMergeWriteLimit(double bytes_per_second) {
+    std::lock_guard<std::mutex> lock(index_mutex_);
+    merge_write_limit_ = bytes_per_second;
+    if (merge_scheduler_) {
+        merge_scheduler_->setMaxWriteBytesPerSec(bytes_per_second);
+    }
+}
+
+void IndexManager::pauseMergesWhen(std::function<bool()> predicate) {
+    std::lock_guard<std::mutex> lock(index_mutex_);
+    merge_pause_predicate_ = std::move(predicate);
+    if (merge_scheduler_) {
+        merge_scheduler_->setPausePredicate(merge_pause_predicate_);
+    }
+}
+
+std::optional<size_t> IndexManager::mergeOnce(const MergeScheduler::WriteHook& on_write) {
+    std::vector<std::shared_ptr<MappedSegment>> inputs;
+    std::vector<std::shared_ptr<MappedSegment>> snapshots;
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(index_mutex_);
+        
+        std::vector<TieredMergePolicy::SegmentInfo> infos;
+        for (const auto& segment : segments_) {
+            infos.push_back({segment->fileSize(), segment->getStoredDocumentCount(),
+                             segment->getDeletedRatio(), merging_.count(segment.get()) != 0});
+        }
+        auto picked = merge_policy_.findMerge(infos);
+        if (picked.empty()) return std::nullopt;
+        
+        // Snapshots fix the tombstones the merge drops; deletes that land
+        // while it runs are carried over when it commits
+        for (size_t i : picked) {
+            inputs.push_back(segments_[i]);
+            snapshots.push_back(segments_[i]->snapshot());
+            merging_.insert(segments_[i].get());
+        }
+        path = disk_index_.newSegmentPath();
+    }
+    
+    auto merged = rewriteSegments(inputs, snapshots, path, on_write);
+    if (!merged) return std::nullopt;
+    return merged->getStoredDocumentCount();
+}
+
+// Writes the live documents of the snapshots, marked in merging_ by the
+// caller, to path without the lock held, then swaps the result in for
+// the inputs. nullptr if a load() or a full rewrite replaced the inputs
+// meanwhile.
+std::shared_ptr<MappedSegment> IndexManager::rewriteSegments(
+        const std::vector<std::shared_ptr<MappedSegment>>& inputs,
+        const std::vector<std::shared_ptr<MappedSegment>>& snapshots,
+        const std::string& path, const MergeScheduler::WriteHook& on_write) {
+    auto unmark = [this, &inputs] {
+        for (const auto& segment : inputs) {
+            merging_.erase(segment.get());
+        }
+    };
+    
+    std::shared_ptr<MappedSegment> merged;
+    try {
+        std::vector<const MappedSegment*> sources;
+        for (const auto& segment : snapshots) {
+            sources.push_back(segment.get());
+        }
+        DiskIndex::writeSegment(path, sources, nullptr, on_write);
+        merged = MappedSegment::open(path);
+    } catch (...) {
+        std::filesystem::remove(path);
+        std::lock_guard<std::mutex> lock(index_mutex_);
+        unmark();
+        throw;
+    }
+    
+    std::lock_guard<std::mutex> lock(index_mutex_);
+    unmark();
+    
+    for (const auto& segment : inputs) {
+        if (std::find(segments_.begin(), segments_.end(), segment) == segments_.end()) {
+            merged.reset();
+            std::filesystem::remove(path);
+            return nullptr;
+        }
+    }
+    
+    // Snapshots fixed the tombstones the rewrite dropped; deletes that
+    // landed while it ran are carried over
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        const auto& snapshot = snapshots[i];
+        inputs[i]->getLiveDocs().forEachDeleted([&](size_t id) {
+            if (snapshot->isLive(id)) merged->removeDocument(id);
+        });
+    }
+    
+    segments_.erase(std::remove_if(segments_.begin(), segments_.end(),
+        [&inputs](const std::shared_ptr<MappedSegment>& segment) {
+            return std::find(inputs.begin(), inputs.end(), segment) != inputs.end();
+        }), segments_.end());
+    segments_.push_back(merged);
+    
+    // Searches still holding a mapping keep reading unlinked files
+    for (const auto& segment : inputs) {
+        disk_index_.release(segment->path());
+    }
+    return merged;
+}
+
+void IndexManager::enablePostingTiering(const PostingTierManager::Options& options) {
+    disablePostingTiering();
+    
+    auto tiering = std::make_shared<PostingTierManager>([this] {
+        std::lock_guard<std::mutex> lock(index_mutex_);
+        return segments_;
+    }, options);
+    tiering->start();
+    
+    std::lock_guard<std::mutex> lock(index_mutex_);
+    tiering_ = std::move(tiering);
+}
+
+void IndexManager::disablePostingTiering() {
+    // Stopped outside the lock: a pass reads segments_ under index_mutex_
+    std::shared_ptr<PostingTierManager> tiering;
+    {
+        std::lock_guard<std::mutex> lock(index_mutex_);
+        tiering = std::move(tiering_);
+    }
+    tiering.reset();
+}
+
+IndexManager::Stats IndexManager::getStats() {
+    std::shared_ptr<PostingTierManager> tiering;
+    {
+        std::lock_guard<std::mutex> lock(index_mutex_);
+        tiering = tiering_;
+    }
+    
+    Stats stats{};
+    if (tiering) {
+        stats.tiering = tiering->getStats();
+    }
+    
+    std::lock_guard<std::mutex> lock(index_mutex_);
+    stats.segments = segments_.size();
+    stats.memtable_documents = index_->getDocumentCount();
+    if (merge_scheduler_) {
+        stats.merges = merge_scheduler_->getStats();
+    }
+    stats.queries = query_latency_.snapshot();
+    return stats;
+}
+
+void IndexManager::flushIfNeededLocked() {
+    if (!merge_scheduler_ || index_->getDocumentCount() < flush_threshold_) return;
+    flushLocked();
+}
+
+void IndexManager::flushLocked() {
+    if (index_->getDocumentCount() == 0) return;
+    
+    std::string path = disk_index_.newSegmentPath();
+    DiskIndex::writeSegment(path, {}, index_.get());
+    segments_.push_back(MappedSegment::open(path));
+    index_ = newMemtable();
+    if (merge_scheduler_) {
+        merge_scheduler_->wake();
+    }
+}
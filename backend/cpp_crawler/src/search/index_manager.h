@@ -1,28 +1,137 @@
 #pragma once
 #include "inverted_index.h"
+#include "merge_policy.h"
+#include "merge_scheduler.h"
+#include "ranker.h"
+#include "url_table.h"
 #include "storage/disk_index.h"
+#include "storage/posting_tier_manager.h"
+#include "system/health_monitor.h"
+#include "utils/latency_histogram.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_set>
 
 class IndexManager {
 public:
-    IndexManager(const std::string& data_path);
+    // Queries are analyzed with analyzer, which must match the one the
+    // documents' terms came from; the memtable uses it as well
+    explicit IndexManager(const std::string& data_path, const Analyzer& analyzer = Analyzer());
+    ~IndexManager();
+    
+    const Analyzer& analyzer() const { return analyzer_; }
     
     void addDocument(const InvertedIndex::Document& doc);
     void removeDocument(const std::string& url);
     void updateDocument(const InvertedIndex::Document& doc);
     
-    std::vector<InvertedIndex::Document> search(const std::string& query);
+    // Applies many changes under one lock acquisition. The upserts are
+    // inverted into a private segment before the lock is taken and then
+    // published together; each URL must appear at most once per batch.
+    void applyBatch(std::vector<InvertedIndex::Document> upserts,
+                    const std::vector<std::string>& deletes);
+    
+    // Returns the best `limit` matches with their stored content; content
+    // is only decompressed for those documents
+    std::vector<InvertedIndex::Document> search(const std::string& query, size_t limit = 20);
     
+    // Checkpoints incrementally: the memtable becomes a new segment and
+    // only deletion bitmaps that changed are written, under a manifest
+    // replaced atomically. load() maps the last checkpoint.
     void save();
     void load();
+    
+    // Background compaction purges tombstoned documents once the deleted
+    // ratio of the index crosses the threshold. A segment is rewritten
+    // without the index lock held, paced by the merge write limit.
+    void setCompactionPolicy(double deleted_ratio, std::chrono::seconds check_interval);
+    void startMaintenance();
+    void stopMaintenance();
+    bool compactIfNeeded();
+    
+    // Background merging. While it runs, the in-memory index is flushed
+    // to a new segment every flush_threshold documents and the
+    // scheduler folds segments together as the policy asks. The settings
+    // below may be made before or after startMerges() and survive a
+    // restart; a write limit set here overrides the one in the options.
+    void startMerges();
+    void startMerges(const MergeScheduler::Options& options);
+    void stopMerges();
+    void setMergePolicy(const TieredMergePolicy& policy);
+    void setFlushThreshold(size_t documents);
+    void setMergeWriteLimit(double bytes_per_second);
+    
+    // Merges stall while the predicate holds
+    void pauseMergesWhen(std::function<bool()> predicate);
+    
+    void pauseMergesOn(const HealthMonitor& monitor, double max_cpu, double max_queue) {
+        pauseMergesWhen([&monitor, max_cpu, max_queue] {
+            return monitor.getMetric(HealthMonitor::CPU_USAGE) > max_cpu ||
+                   monitor.getMetric(HealthMonitor::QUEUE_SIZE) > max_queue;
+        });
+    }
+    
+    // Keeps the most read posting lists of all segments in RAM within
+    // the options' memory budget, rebalancing in the background
+    void enablePostingTiering(const PostingTierManager::Options& options);
+    void disablePostingTiering();
+    
+    // Runs one merge on the calling thread; nullopt if none was due
+    std::optional<size_t> mergeOnce(const MergeScheduler::WriteHook& on_write = nullptr);
+    
+    struct Stats {
+        size_t segments;
+        size_t memtable_documents;
+        MergeScheduler::Stats merges;
+        LatencyHistogram::Snapshot queries;
+        PostingTierManager::Stats tiering;
+    };
+    
+    // Merge throughput and query latency side by side
+    Stats getStats();
 
 private:
+    Analyzer analyzer_;
     std::unique_ptr<InvertedIndex> index_;
+    std::vector<std::shared_ptr<MappedSegment>> segments_;
     DiskIndex disk_index_;
+    UrlTable url_table_;
+    size_t next_doc_id_ = 0;
     std::mutex index_mutex_;
     
+    double compaction_ratio_ = 0.2;
+    std::chrono::seconds compaction_interval_{60};
+    std::atomic<bool> maintenance_running_{false};
+    std::thread maintenance_thread_;
+    std::mutex maintenance_mutex_;
+    std::condition_variable maintenance_cv_;
+    
+    TieredMergePolicy merge_policy_;
+    size_t flush_threshold_ = 100000;
+    std::unordered_set<const MappedSegment*> merging_;
+    std::unique_ptr<MergeScheduler> merge_scheduler_;
+    std::optional<double> merge_write_limit_;
+    std::function<bool()> merge_pause_predicate_;
+    LatencyHistogram query_latency_;
+    std::shared_ptr<PostingTierManager> tiering_;
+    
     void applyUpdates();
+    std::unique_ptr<InvertedIndex> newMemtable() const;
+    void addLocked(InvertedIndex::Document doc);
+    void removeLocked(size_t id);
+    void saveLocked();
+    void flushIfNeededLocked();
+    void flushLocked();
+    void maintenanceLoop();
+    std::shared_ptr<MappedSegment> rewriteSegments(
+        const std::vector<std::shared_ptr<MappedSegment>>& inputs,
+        const std::vector<std::shared_ptr<MappedSegment>>& snapshots,
+        const std::string& path, const MergeScheduler::WriteHook& on_write);
     std::vector<InvertedIndex::Document> processResults(
-        const std::vector<AdvancedRanker::Result>& results);
-}; 
\ No newline at end of file
+        const std::vector<Ranker::Result>& results);
+};
@@ -0,0 +1,142 @@
+#pragma once
+#include "ranker.h"
+#include "storage/disk_index.h"
+#include "text/analyzer.h"
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Immutable, read-only index built offline (e.g. by BulkIndexer) and
+// served as is. Nothing mutates it after open(), so any number of threads
+// may query it without locking; holders of the shared pointer keep the
+// mapping alive. When the last one lets go the snapshot is unmapped on a
+// background thread, never on the query thread that happened to drop it.
+class IndexSnapshot {
+public:
+    // analyzer must match the one the index was built with. dir must hold
+    // a single segment, as bulk_indexer writes; open() throws for an
+    // IndexManager directory whose manifest lists several.
+    static std::shared_ptr<const IndexSnapshot> open(const std::string& dir, bool prefault,
+                                                     const Analyzer& analyzer = Analyzer()) {
+        auto segment = DiskIndex(dir).open();
+        if (!segment) {
+            throw std::runtime_error("No index found in " + dir);
+        }
+        size_t prefaulted = prefault ? segment->prefault() : 0;
+        return std::shared_ptr<const IndexSnapshot>(
+            new IndexSnapshot(dir, std::move(segment), prefaulted, analyzer),
+            [](const IndexSnapshot* snapshot) { Reaper::instance().release(snapshot); });
+    }
+
+    ~IndexSnapshot() {
+        live_count_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    // Snapshots still mapped, including released ones not yet unmapped.
+    // More than one after a swap means the old index has not drained.
+    static size_t liveCount() {
+        return live_count_.load(std::memory_order_relaxed);
+    }
+
+    std::vector<InvertedIndex::Document> search(const std::string& query, size_t limit = 20) const {
+        auto terms = analyzer_.analyze(query);
+        auto results = Ranker::rank(terms, *segment_, segment_->getDocumentCount());
+        if (results.size() > limit) {
+            results.resize(limit);
+        }
+
+        std::vector<InvertedIndex::Document> docs;
+        docs.reserve(results.size());
+        for (const auto& result : results) {
+            docs.push_back(segment_->getStoredDocument(result.doc_id));
+        }
+        return docs;
+    }
+
+    const std::string& path() const { return path_; }
+    uint64_t version() const { return version_; }
+    size_t documentCount() const { return segment_->getDocumentCount(); }
+    size_t mappedBytes() const { return segment_->fileSize(); }
+    size_t prefaultedBytes() const { return prefaulted_bytes_; }
+    const Analyzer& analyzer() const { return analyzer_; }
+    const MappedSegment& segment() const { return *segment_; }
+
+private:
+    std::string path_;
+    std::shared_ptr<MappedSegment> segment_;
+    size_t prefaulted_bytes_;
+    Analyzer analyzer_;
+    uint64_t version_;
+    static inline std::atomic<size_t> live_count_{0};
+
+    // Deletes released snapshots on its own thread
+    class Reaper {
+    public:
+        static Reaper& instance() {
+            static Reaper reaper;
+            return reaper;
+        }
+
+        void release(const IndexSnapshot* snapshot) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!stopping_) {
+                    released_.push_back(snapshot);
+                    cv_.notify_one();
+                    return;
+                }
+            }
+            delete snapshot;
+        }
+
+        ~Reaper() {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stopping_ = true;
+            }
+            cv_.notify_one();
+            thread_.join();
+        }
+
+    private:
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        std::vector<const IndexSnapshot*> released_;
+        bool stopping_ = false;
+        std::thread thread_;
+
+        Reaper() : thread_(&Reaper::run, this) {}
+
+        void run() {
+            std::unique_lock<std::mutex> lock(mutex_);
+            while (true) {
+                cv_.wait(lock, [this] { return stopping_ || !released_.empty(); });
+                std::vector<const IndexSnapshot*> batch;
+                batch.swap(released_);
+                lock.unlock();
+                for (const auto* snapshot : batch) {
+                    delete snapshot;
+                }
+                lock.lock();
+                if (stopping_ && released_.empty()) return;
+            }
+        }
+    };
+
+    IndexSnapshot(const std::string& path, std::shared_ptr<MappedSegment> segment, size_t prefaulted,
+                  const Analyzer& analyzer)
+        : path_(path), segment_(std::move(segment)), prefaulted_bytes_(prefaulted), analyzer_(analyzer),
+          version_(nextVersion()) {
+        live_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static uint64_t nextVersion() {
+        static std::atomic<uint64_t> next{1};
+        return next.fetch_add(1, std::memory_order_relaxed);
+    }
+};
@@ -0,0 +1,93 @@
+#pragma once
+#include "index_snapshot.h"
+#include "analytics/search_analytics.h"
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+// Brings a freshly mapped index up to speed before it takes traffic:
+// faults in the dictionary and doc table, starts read-ahead of the
+// posting lists the given queries touch, then replays the queries so the
+// block cache holds the documents they return. Everything stops at the
+// time budget.
+class IndexWarmer {
+public:
+    struct Options {
+        size_t max_queries = 1000;
+        std::chrono::milliseconds time_budget{30000};
+        size_t max_advise_bytes = size_t(256) << 20;  // posting read-ahead
+    };
+
+    struct Report {
+        size_t prefaulted_bytes = 0;
+        size_t terms_advised = 0;
+        size_t advised_bytes = 0;
+        size_t queries_replayed = 0;
+        double seconds = 0;
+        bool budget_exhausted = false;
+    };
+
+    // The n most frequent recorded queries, most frequent first
+    static std::vector<std::string> topQueries(const SearchAnalytics& analytics, size_t n) {
+        auto popular = analytics.getPopularQueries(n);
+        std::vector<std::pair<std::string, int>> ranked(popular.begin(), popular.end());
+        std::stable_sort(ranked.begin(), ranked.end(),
+            [](const auto& a, const auto& b) { return a.second > b.second; });
+
+        std::vector<std::string> queries;
+        for (auto& [query, count] : ranked) {
+            queries.push_back(std::move(query));
+        }
+        return queries;
+    }
+
+    // Queries are expected most important first
+    static Report warm(const IndexSnapshot& snapshot, const std::vector<std::string>& queries) {
+        return warm(snapshot, queries, Options());
+    }
+
+    static Report warm(const IndexSnapshot& snapshot, const std::vector<std::string>& queries,
+                       const Options& options) {
+        auto started = std::chrono::steady_clock::now();
+        auto deadline = started + options.time_budget;
+        const auto& segment = snapshot.segment();
+        size_t count = std::min(queries.size(), options.max_queries);
+
+        Report report;
+        bool complete = true;
+        report.prefaulted_bytes = segment.prefault(deadline, &complete);
+        report.budget_exhausted = !complete;
+        auto expired = [&] {
+            if (!report.budget_exhausted && std::chrono::steady_clock::now() >= deadline) {
+                report.budget_exhausted = true;
+            }
+            return report.budget_exhausted;
+        };
+
+        // Read-ahead is asynchronous, so advise every hot list before
+        // replaying and let the kernel overlap the reads
+        std::unordered_set<std::string> seen;
+        for (size_t i = 0; i < count && !expired() &&
+                           report.advised_bytes < options.max_advise_bytes; ++i) {
+            for (const auto& term : snapshot.analyzer().analyze(queries[i])) {
+                if (expired()) break;
+                if (!seen.insert(term).second) continue;
+                size_t bytes = segment.adviseTerm(term);
+                if (bytes == 0) continue;
+                report.terms_advised++;
+                report.advised_bytes += bytes;
+            }
+        }
+
+        for (size_t i = 0; i < count && !expired(); ++i) {
+            snapshot.search(queries[i]);
+            report.queries_replayed++;
+        }
+
+        report.seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - started).count();
+        return report;
+    }
+};
@@ -1,9 +1,13 @@
 #pragma once
 
+#include "live_docs.h"
+#include "../text/analyzer.h"
 #include <unordered_map>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <algorithm>
+#include <iterator>
 
 class InvertedIndex {
 public:
@@ -11,7 +15,9 @@ public:
         size_t id;
         std::string url;
         std::string title;
-        std::vector<std::string> tokens;
+        std::vector<uint32_t> terms;       // term ids, inverted by addDocument, not kept
+        std::string content;               // stored for display, not indexed
+        uint32_t length = 0;               // term count, set by addDocument
     };
     
     struct Posting {
@@ -20,40 +26,204 @@ public:
         std::vector<size_t> positions;
     };
     
+    // Only the stored fields and the term count are kept once the terms
+    // are inverted; the postings already hold everything else.
     void addDocument(const Document& doc) {
-        documents_[doc.id] = doc;
+        indexTerms(doc);
+        documents_[doc.id] = {doc.id, doc.url, doc.title, {}, doc.content,
+                              static_cast<uint32_t>(doc.terms.size())};
+    }
+    
+    void addDocument(Document&& doc) {
+        indexTerms(doc);
+        doc.length = static_cast<uint32_t>(doc.terms.size());
+        std::vector<uint32_t>().swap(doc.terms);
+        size_t id = doc.id;
+        documents_[id] = std::move(doc);
+    }
+    
+    // Analyzes text straight into the postings instead of inverting
+    // doc.terms; each term is hashed as bytes once, by the dictionary.
+    // text may view a field of doc. Returns the term count.
+    uint32_t addDocument(Document&& doc, std::string_view text) {
+        size_t id = doc.id;
+        size_t count = analyzer_.forEachTermId(text, fold_buffer_, TermDictionary::shared(),
+            [this, id](uint32_t term, size_t pos) {
+                addPosting(index_[term], id, pos);
+            });
         
-        for (size_t pos = 0; pos < doc.tokens.size(); ++pos) {
-            const auto& token = doc.tokens[pos];
-            auto& postings = index_[token];
-            
-            auto it = std::find_if(postings.begin(), postings.end(),
-                [doc](const Posting& p) { return p.doc_id == doc.id; });
+        doc.length = static_cast<uint32_t>(count);
+        std::vector<uint32_t>().swap(doc.terms);
+        documents_[id] = std::move(doc);
+        return static_cast<uint32_t>(count);
+    }
+    
+    // Moves every document of `other` into this index. Ids must not overlap.
+    void merge(InvertedIndex&& other) {
+        for (auto& [term, postings] : other.index_) {
+            auto& target = index_[term];
+            bool sorted = target.empty() || postings.empty() ||
+                target.back().doc_id < postings.front().doc_id;
             
-            if (it != postings.end()) {
-                it->frequency++;
-                it->positions.push_back(pos);
+            if (target.empty()) {
+                target = std::move(postings);
             } else {
-                postings.push_back({doc.id, 1, {pos}});
+                target.insert(target.end(),
+                    std::make_move_iterator(postings.begin()),
+                    std::make_move_iterator(postings.end()));
             }
+            if (!sorted) {
+                std::sort(target.begin(), target.end(),
+                    [](const Posting& a, const Posting& b) { return a.doc_id < b.doc_id; });
+            }
+        }
+        
+        for (auto& [id, doc] : other.documents_) {
+            if (!other.live_docs_.isLive(id)) {
+                live_docs_.markDeleted(id);
+            }
+            documents_[id] = std::move(doc);
+        }
+        
+        other.index_.clear();
+        other.documents_.clear();
+        other.live_docs_.clear();
+    }
+    
+    // Deletes are tombstoned; postings are only purged by compact()
+    void removeDocument(size_t id) {
+        if (documents_.count(id)) {
+            live_docs_.markDeleted(id);
+        }
+    }
+    
+    bool hasDocument(size_t id) const {
+        return documents_.count(id) != 0 && live_docs_.isLive(id);
+    }
+    
+    bool isLive(size_t id) const {
+        return live_docs_.isLive(id);
+    }
+    
+    size_t getDeletedCount() const {
+        return live_docs_.deletedCount();
+    }
+    
+    double getDeletedRatio() const {
+        return documents_.empty() ? 0.0
+            : static_cast<double>(live_docs_.deletedCount()) / documents_.size();
+    }
+    
+    const LiveDocs& getLiveDocs() const {
+        return live_docs_;
+    }
+    
+    // Physically drop tombstoned documents from every posting list
+    void compact() {
+        if (live_docs_.empty()) return;
+        
+        for (auto it = index_.begin(); it != index_.end();) {
+            auto& postings = it->second;
+            postings.erase(std::remove_if(postings.begin(), postings.end(),
+                [this](const Posting& p) { return !live_docs_.isLive(p.doc_id); }), postings.end());
+            it = postings.empty() ? index_.erase(it) : std::next(it);
+        }
+        
+        for (auto it = documents_.begin(); it != documents_.end();) {
+            it = live_docs_.isLive(it->first) ? std::next(it) : documents_.erase(it);
         }
+        
+        live_docs_.clear();
     }
     
-    const std::vector<Posting>& getPostings(const std::string& term) const {
+    const std::vector<Posting>& getPostings(uint32_t term) const {
         static const std::vector<Posting> empty;
         auto it = index_.find(term);
         return it != index_.end() ? it->second : empty;
     }
     
+    size_t getDocumentFrequency(uint32_t term) const {
+        return getPostings(term).size();
+    }
+    
+    // Calls f(doc_id, frequency) for every live posting of the term
+    template <typename F>
+    void forEachPosting(uint32_t term, F&& f) const {
+        for (const auto& posting : getPostings(term)) {
+            if (live_docs_.isLive(posting.doc_id)) {
+                f(posting.doc_id, posting.frequency);
+            }
+        }
+    }
+    
     const Document& getDocument(size_t id) const {
         return documents_.at(id);
     }
     
     size_t getDocumentCount() const {
-        return documents_.size();
+        return documents_.size() - live_docs_.deletedCount();
+    }
+    
+    // The analyzer the text form of addDocument uses; queries must go
+    // through an equal one
+    void setAnalyzer(const Analyzer& analyzer) { analyzer_ = analyzer; }
+    const Analyzer& analyzer() const { return analyzer_; }
+    
+    // Keyed by TermDictionary::shared() id
+    const std::unordered_map<uint32_t, std::vector<Posting>>& getTerms() const {
+        return index_;
+    }
+    
+    const std::unordered_map<size_t, Document>& getDocuments() const {
+        return documents_;
+    }
+    
+    // Renumber documents (old id -> new id). Postings are re-sorted by the
+    // new ids so that d-gaps stay small for compression.
+    void remapDocuments(const std::unordered_map<size_t, size_t>& new_ids) {
+        compact();
+        
+        std::unordered_map<size_t, Document> remapped;
+        remapped.reserve(documents_.size());
+        for (auto& [id, doc] : documents_) {
+            size_t new_id = new_ids.at(id);
+            doc.id = new_id;
+            remapped.emplace(new_id, std::move(doc));
+        }
+        documents_ = std::move(remapped);
+        
+        for (auto& [term, postings] : index_) {
+            for (auto& posting : postings) {
+                posting.doc_id = new_ids.at(posting.doc_id);
+            }
+            std::sort(postings.begin(), postings.end(),
+                [](const Posting& a, const Posting& b) { return a.doc_id < b.doc_id; });
+        }
     }
     
 private:
-    std::unordered_map<std::string, std::vector<Posting>> index_;
+    std::unordered_map<uint32_t, std::vector<Posting>> index_;
     std::unordered_map<size_t, Document> documents_;
+    LiveDocs live_docs_;
+    // Reused by the text form of addDocument
+    std::string fold_buffer_;
+    Analyzer analyzer_;
+    
+    // kNoTerm marks a position without a term
+    void indexTerms(const Document& doc) {
+        for (size_t pos = 0; pos < doc.terms.size(); ++pos) {
+            if (doc.terms[pos] == TermDictionary::kNoTerm) continue;
+            addPosting(index_[doc.terms[pos]], doc.id, pos);
+        }
+    }
+    
+    static void addPosting(std::vector<Posting>& postings, size_t doc_id, size_t pos) {
+        // This document's posting, if any, is the last one appended
+        if (!postings.empty() && postings.back().doc_id == doc_id) {
+            postings.back().frequency++;
+            postings.back().positions.push_back(pos);
+        } else {
+            postings.push_back({doc_id, 1, {pos}});
+        }
+    }
 }; 
\ No newline at end of file
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Per-segment deletion bitmap. A set bit is a tombstone; documents without
+// a bit are live, so the bitmap only grows to cover ids that were deleted.
+class LiveDocs {
+public:
+    bool isLive(size_t id) const {
+        if (id < base_) return true;
+        size_t word = (id - base_) >> 6;
+        return word >= bits_.size() || !(bits_[word] & (uint64_t(1) << (id & 63)));
+    }
+
+    // Returns false if the document was already deleted
+    bool markDeleted(size_t id) {
+        if (bits_.empty()) {
+            base_ = id & ~size_t(63);
+        } else if (id < base_) {
+            size_t new_base = id & ~size_t(63);
+            bits_.insert(bits_.begin(), (base_ - new_base) >> 6, 0);
+            base_ = new_base;
+        }
+
+        size_t word = (id - base_) >> 6;
+        if (word >= bits_.size()) {
+            bits_.resize(word + 1, 0);
+        }
+
+        uint64_t mask = uint64_t(1) << (id & 63);
+        if (bits_[word] & mask) return false;
+        bits_[word] |= mask;
+        deleted_++;
+        return true;
+    }
+
+    size_t deletedCount() const {
+        return deleted_;
+    }
+
+    bool empty() const {
+        return deleted_ == 0;
+    }
+
+    void clear() {
+        bits_.clear();
+        base_ = 0;
+        deleted_ = 0;
+    }
+
+    template <typename F>
+    void forEachDeleted(F&& f) const {
+        for (size_t w = 0; w < bits_.size(); ++w) {
+            uint64_t word = bits_[w];
+            while (word) {
+                f(base_ + (w << 6) + static_cast<size_t>(__builtin_ctzll(word)));
+                word &= word - 1;
+            }
+        }
+    }
+
+    size_t base() const { return base_; }
+    const std::vector<uint64_t>& words() const { return bits_; }
+
+    // [uint64 base][uint64 word count][words], native byte order
+    std::string serialize() const {
+        std::string out(16 + bits_.size() * 8, '\0');
+        uint64_t header[2] = {base_, bits_.size()};
+        std::memcpy(&out[0], header, sizeof(header));
+        if (!bits_.empty()) std::memcpy(&out[16], bits_.data(), bits_.size() * 8);
+        return out;
+    }
+
+    static LiveDocs deserialize(const std::string& data) {
+        uint64_t header[2];
+        if (data.size() < sizeof(header)) {
+            throw std::runtime_error("Corrupt deletion bitmap");
+        }
+        std::memcpy(header, data.data(), sizeof(header));
+        if (data.size() != 16 + header[1] * 8) {
+            throw std::runtime_error("Corrupt deletion bitmap");
+        }
+
+        LiveDocs docs;
+        docs.base_ = header[0];
+        docs.bits_.resize(header[1]);
+        if (!docs.bits_.empty()) std::memcpy(docs.bits_.data(), data.data() + 16, header[1] * 8);
+        for (uint64_t word : docs.bits_) {
+            docs.deleted_ += static_cast<size_t>(__builtin_popcountll(word));
+        }
+        return docs;
+    }
+
+private:
+    std::vector<uint64_t> bits_;
+    size_t base_ = 0;
+    size_t deleted_ = 0;
+};
@@ -0,0 +1,101 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// Tiered merge selection after Lucene's TieredMergePolicy. The index may
+// hold about segments_per_tier segments of each size tier, tiers growing
+// by max_merge_at_once; beyond that budget the cheapest merge is picked:
+// segments of similar size (low skew), small in total, with many deletes
+// to reclaim. Segments below floor_segment_bytes count as that size so
+// tiny flushes are merged eagerly.
+class TieredMergePolicy {
+public:
+    struct SegmentInfo {
+        size_t bytes = 0;
+        size_t docs = 0;
+        double deleted_ratio = 0;
+        bool merging = false;  // already an input of a running merge
+    };
+
+    size_t segments_per_tier = 10;
+    size_t max_merge_at_once = 10;
+    size_t floor_segment_bytes = size_t(2) << 20;
+    size_t max_merged_segment_bytes = size_t(5) << 30;
+
+    // Returns the positions of the segments to merge; empty if none should
+    std::vector<size_t> findMerge(const std::vector<SegmentInfo>& segments) const {
+        struct Candidate {
+            size_t index;
+            double live_bytes;
+        };
+
+        std::vector<Candidate> eligible;
+        double total_bytes = 0;
+        double min_bytes = 0;
+        for (size_t i = 0; i < segments.size(); ++i) {
+            const auto& info = segments[i];
+            double live = info.bytes * (1.0 - info.deleted_ratio);
+            // Segments already near the cap are left alone
+            if (info.merging || live >= max_merged_segment_bytes / 2.0) continue;
+            eligible.push_back({i, live});
+            total_bytes += live;
+            min_bytes = eligible.size() == 1 ? live : std::min(min_bytes, live);
+        }
+        if (eligible.size() < 2) return {};
+
+        std::sort(eligible.begin(), eligible.end(),
+            [](const Candidate& a, const Candidate& b) { return a.live_bytes > b.live_bytes; });
+
+        // Segment budget: segments_per_tier per tier, starting at the floor
+        double level = std::max<double>(floored(min_bytes), 1.0);
+        double bytes_left = total_bytes;
+        double allowed = 0;
+        while (true) {
+            double at_level = bytes_left / level;
+            if (at_level < segments_per_tier) {
+                allowed += std::ceil(at_level);
+                break;
+            }
+            allowed += segments_per_tier;
+            bytes_left -= segments_per_tier * level;
+            level *= max_merge_at_once;
+        }
+        if (eligible.size() <= static_cast<size_t>(allowed)) return {};
+
+        std::vector<size_t> best;
+        double best_score = 0;
+        for (size_t start = 0; start + 1 < eligible.size(); ++start) {
+            std::vector<size_t> merge;
+            double merge_bytes = 0;
+            double floored_bytes = 0;
+            double largest = 0;
+            double raw_bytes = 0;
+            for (size_t i = start; i < eligible.size() && merge.size() < max_merge_at_once; ++i) {
+                const auto& candidate = eligible[i];
+                if (merge_bytes + candidate.live_bytes > max_merged_segment_bytes) continue;
+                merge.push_back(candidate.index);
+                merge_bytes += candidate.live_bytes;
+                floored_bytes += floored(candidate.live_bytes);
+                largest = std::max(largest, floored(candidate.live_bytes));
+                raw_bytes += segments[candidate.index].bytes;
+            }
+            if (merge.size() < 2) continue;
+
+            double skew = largest / floored_bytes;
+            double reclaim = raw_bytes > 0 ? merge_bytes / raw_bytes : 1.0;
+            double score = skew * std::pow(merge_bytes, 0.05) * reclaim * reclaim;
+            if (best.empty() || score < best_score) {
+                best = std::move(merge);
+                best_score = score;
+            }
+        }
+        return best;
+    }
+
+private:
+    double floored(double bytes) const {
+        return std::max(bytes, static_cast<double>(floor_segment_bytes));
+    }
+};
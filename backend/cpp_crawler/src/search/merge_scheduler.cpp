@@ -0,0 +1,163 @@
+#include "merge_scheduler.h"
+#include <cerrno>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace {
+
+std::chrono::nanoseconds since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::steady_clock::now() - start;
+}
+
+} // namespace
+
+MergeScheduler::MergeScheduler(MergeFn merge)
+    : MergeScheduler(std::move(merge), Options()) {}
+
+MergeScheduler::MergeScheduler(MergeFn merge, const Options& options)
+    : merge_(std::move(merge)), options_(options), throttle_(std::make_shared<IoThrottle>(options.max_write_bytes_per_sec)) {
+    if (options_.threads == 0) {
+        options_.threads = 1;
+    }
+}
+
+MergeScheduler::~MergeScheduler() {
+    stop();
+}
+
+void MergeScheduler::start() {
+    if (running_.exchange(true)) return;
+    for (size_t i = 0; i < options_.threads; ++i) {
+        threads_.emplace_back(&MergeScheduler::threadLoop, this);
+    }
+}
+
+void MergeScheduler::stop() {
+    if (!running_.exchange(false)) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cv_.notify_all();
+    }
+    for (auto& thread : threads_) {
+        if (thread.joinable()) thread.join();
+    }
+    threads_.clear();
+}
+
+void MergeScheduler::wake() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    wake_pending_ = true;
+    cv_.notify_one();
+}
+
+void MergeScheduler::setPausePredicate(std::function<bool()> predicate) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pause_predicate_ = std::move(predicate);
+    next_poll_ = {};
+    cv_.notify_all();
+}
+
+void MergeScheduler::setMaxWriteBytesPerSec(double bytes_per_second) {
+    throttle_->setRate(bytes_per_second);
+}
+
+MergeScheduler::Stats MergeScheduler::getStats() const {
+    bool paused;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        paused = paused_;
+    }
+    return {
+        merges_.load(),
+        failures_.load(),
+        docs_merged_.load(),
+        bytes_written_.load(),
+        merge_ns_.load() / 1e9,
+        paused_ns_.load() / 1e9,
+        active_.load(),
+        paused
+    };
+}
+
+void MergeScheduler::threadLoop() {
+    lowerPriority(options_.nice);
+    WriteHook hook = [this](size_t bytes) { beforeWrite(bytes); };
+
+    while (running_) {
+        waitWhilePaused();
+        if (!running_) break;
+
+        std::optional<size_t> docs;
+        auto started = std::chrono::steady_clock::now();
+        active_++;
+        try {
+            docs = merge_(hook);
+        } catch (const Cancelled&) {
+            active_--;
+            break;
+        } catch (...) {
+            // The merge function leaves the index untouched on failure;
+            // back off as if idle rather than retrying in a tight loop
+            failures_++;
+        }
+        active_--;
+
+        if (docs) {
+            merges_++;
+            docs_merged_ += *docs;
+            merge_ns_ += since(started).count();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait_for(lock, options_.idle_interval,
+            [this] { return !running_ || wake_pending_; });
+        wake_pending_ = false;
+    }
+}
+
+void MergeScheduler::beforeWrite(size_t bytes) {
+    waitWhilePaused();
+    if (!running_) throw Cancelled();
+    throttle_->acquire(bytes);
+    bytes_written_ += bytes;
+}
+
+bool MergeScheduler::shouldPause() {
+    // Caller holds mutex_
+    if (!pause_predicate_) return false;
+    auto now = std::chrono::steady_clock::now();
+    if (now >= next_poll_) {
+        paused_ = pause_predicate_();
+        next_poll_ = now + kPausePoll;
+    }
+    return paused_;
+}
+
+void MergeScheduler::waitWhilePaused() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!shouldPause()) return;
+
+    auto started = std::chrono::steady_clock::now();
+    while (running_ && shouldPause()) {
+        cv_.wait_for(lock, kPausePoll);
+    }
+    paused_ns_ += since(started).count();
+}
+
+void MergeScheduler::lowerPriority(int nice) {
+    // Both are per-thread on Linux and best effort: an unprivileged
+    // process may lower its priority but never raise it back
+    id_t tid = static_cast<id_t>(::syscall(SYS_gettid));
+    errno = 0;
+    int current = ::getpriority(PRIO_PROCESS, tid);
+    if (errno == 0) {
+        ::setpriority(PRIO_PROCESS, tid, current + nice);
+    }
+#ifdef SYS_ioprio_set
+    constexpr int kIoprioWhoProcess = 1;
+    constexpr int kIoprioClassIdle = 3;
+    ::syscall(SYS_ioprio_set, kIoprioWhoProcess, 0, kIoprioClassIdle << 13);
+#endif
+}
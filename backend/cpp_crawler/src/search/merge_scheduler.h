@@ -0,0 +1,104 @@
+#pragma once
+#include "utils/io_throttle.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+// Runs segment merges on low-priority background threads. Each thread
+// repeatedly asks the merge function for one merge; every write the merge
+// issues passes through a hook that holds it while the pause predicate is
+// true (e.g. the host is busy serving queries) and paces it under the
+// write-bandwidth limit.
+class MergeScheduler {
+public:
+    using WriteHook = std::function<void(size_t)>;
+    // Performs one merge and returns the number of documents written, or
+    // nullopt when there is nothing to merge
+    using MergeFn = std::function<std::optional<size_t>(const WriteHook&)>;
+
+    struct Options {
+        size_t threads = 1;
+        double max_write_bytes_per_sec = 0;  // 0: unlimited
+        int nice = 10;                        // added to the thread's nice value
+        std::chrono::milliseconds idle_interval{1000};
+    };
+
+    struct Stats {
+        uint64_t merges;
+        uint64_t failures;
+        uint64_t docs_merged;
+        uint64_t bytes_written;
+        double merge_seconds;
+        double paused_seconds;
+        size_t running;
+        bool paused;
+
+        // Write throughput while merging, pauses included
+        double bytesPerSecond() const {
+            return merge_seconds > 0 ? bytes_written / merge_seconds : 0;
+        }
+    };
+
+    explicit MergeScheduler(MergeFn merge);
+    MergeScheduler(MergeFn merge, const Options& options);
+    ~MergeScheduler();
+
+    MergeScheduler(const MergeScheduler&) = delete;
+    MergeScheduler& operator=(const MergeScheduler&) = delete;
+
+    void start();
+    void stop();
+
+    // Prompts an idle thread to look for a merge now
+    void wake();
+
+    // Merges stall while the predicate returns true. It is polled at
+    // most every 100 ms, so it may be moderately expensive.
+    void setPausePredicate(std::function<bool()> predicate);
+    void setMaxWriteBytesPerSec(double bytes_per_second);
+
+    // The write-bandwidth limiter, for other background writers (such as
+    // compaction) to share the merges' budget
+    std::shared_ptr<IoThrottle> throttle() const { return throttle_; }
+
+    Stats getStats() const;
+
+private:
+    static constexpr std::chrono::milliseconds kPausePoll{100};
+
+    // Thrown through the merge function when stop() interrupts a merge
+    struct Cancelled {};
+
+    MergeFn merge_;
+    Options options_;
+    std::shared_ptr<IoThrottle> throttle_;
+    std::vector<std::thread> threads_;
+    std::atomic<bool> running_{false};
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::function<bool()> pause_predicate_;
+    bool paused_ = false;
+    bool wake_pending_ = false;
+    std::chrono::steady_clock::time_point next_poll_{};
+
+    std::atomic<uint64_t> merges_{0};
+    std::atomic<uint64_t> failures_{0};
+    std::atomic<uint64_t> docs_merged_{0};
+    std::atomic<uint64_t> bytes_written_{0};
+    std::atomic<uint64_t> merge_ns_{0};
+    std::atomic<uint64_t> paused_ns_{0};
+    std::atomic<size_t> active_{0};
+
+    void threadLoop();
+    void beforeWrite(size_t bytes);
+    bool shouldPause();
+    void waitWhilePaused();
+    static void lowerPriority(int nice);
+};
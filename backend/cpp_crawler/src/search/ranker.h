@@ -2,7 +2,6 @@
 
 #include "inverted_index.h"
 #include <cmath>
-#include <unordered_set>
 
 class Ranker {
 public:
@@ -11,42 +10,40 @@ public:
         double score;
     };
     
+    // Works with any index exposing getDocumentFrequency() and
+    // forEachPosting() for the term type: term ids for InvertedIndex,
+    // term bytes for MappedSegment.
+    template <typename Index, typename Term>
     static std::vector<Result> rank(
-        const std::vector<std::string>& query_terms,
-        const InvertedIndex& index,
+        const std::vector<Term>& query_terms,
+        const Index& index,
         size_t total_docs) {
         
-        std::unordered_set<size_t> candidate_docs;
         std::unordered_map<size_t, double> scores;
-        
-        // Find all candidate documents
         for (const auto& term : query_terms) {
-            for (const auto& posting : index.getPostings(term)) {
-                candidate_docs.insert(posting.doc_id);
-            }
-        }
-        
-        // Calculate scores
-        for (size_t doc_id : candidate_docs) {
-            double score = 0.0;
-            
-            for (const auto& term : query_terms) {
-                const auto& postings = index.getPostings(term);
-                auto it = std::find_if(postings.begin(), postings.end(),
-                    [doc_id](const auto& p) { return p.doc_id == doc_id; });
-                
-                if (it != postings.end()) {
-                    double tf = 1.0 + log(it->frequency);
-                    double idf = log(total_docs / (1.0 + postings.size()));
-                    score += tf * idf;
-                }
-            }
-            
-            scores[doc_id] = score;
+            accumulate(term, idf(total_docs, index.getDocumentFrequency(term)), index, scores);
         }
-        
-        // Sort results
+        return sortScores(scores);
+    }
+    
+    static double idf(size_t total_docs, size_t doc_freq) {
+        return log(total_docs / (1.0 + doc_freq));
+    }
+    
+    // Term-at-a-time scoring. The idf is passed in so several segments can
+    // be scored against shared collection statistics.
+    template <typename Index, typename Term>
+    static void accumulate(const Term& term, double term_idf, const Index& index,
+                           std::unordered_map<size_t, double>& scores) {
+        index.forEachPosting(term, [&](size_t doc_id, size_t frequency) {
+            double tf = 1.0 + log(frequency);
+            scores[doc_id] += tf * term_idf;
+        });
+    }
+    
+    static std::vector<Result> sortScores(const std::unordered_map<size_t, double>& scores) {
         std::vector<Result> results;
+        results.reserve(scores.size());
         for (const auto& [doc_id, score] : scores) {
             results.push_back({doc_id, score});
         }
@@ -58,4 +55,4 @@ public:
         
         return results;
     }
-}; 
\ No newline at end of file
+};
@@ -0,0 +1,257 @@
+#include "realtime_updater.h"
+#include "storage/segment_format.h"
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+
+RealtimeUpdater::RealtimeUpdater(IndexManager& manager, const std::string& wal_path,
+                                 size_t group_commit_bytes,
+                                 std::chrono::milliseconds group_commit_delay,
+                                 size_t queue_capacity)
+    : index_manager_(manager), wal_(wal_path, group_commit_bytes, group_commit_delay),
+      task_queue_(queue_capacity) {}
+
+RealtimeUpdater::~RealtimeUpdater() {
+    stop();
+}
+
+uint64_t RealtimeUpdater::enqueue(UpdateTask&& task, EnqueueMode mode) {
+    std::string body = encode(task);
+
+    // Producers only share the gate, so checkpoint() never sees a task
+    // that is queued but not yet logged, and stop() never closes the
+    // queue between a push and its log record
+    std::shared_lock<std::shared_mutex> gate(enqueue_gate_);
+    if (!running_ || task_queue_.closed()) {
+        return 0;
+    }
+
+    static const MpscQueue<UpdateTask>::PushMode modes[] = {
+        MpscQueue<UpdateTask>::BLOCK, MpscQueue<UpdateTask>::TRY, MpscQueue<UpdateTask>::SHED
+    };
+    uint64_t ticket;
+    if (!task_queue_.push(std::move(task), modes[mode], &ticket)) {
+        return 0;
+    }
+
+    // Concurrent producers may log out of queue order; the ticket lets
+    // replay restore the order the indexer applied
+    std::string payload;
+    SegmentFormat::writeVarint(payload, epoch_);
+    SegmentFormat::writeVarint(payload, ticket);
+    payload += body;
+    return wal_.append(payload);
+}
+
+void RealtimeUpdater::waitDurable(uint64_t lsn) {
+    wal_.waitDurable(lsn);
+}
+
+void RealtimeUpdater::start() {
+    if (running_) return;
+
+    // Recovery: everything still in the log postdates the last checkpoint
+    struct Replayed {
+        uint64_t epoch;
+        uint64_t ticket;
+        UpdateTask task;
+    };
+    std::vector<Replayed> replayed;
+    wal_.replay([&](const std::string& payload) {
+        Replayed r;
+        r.task = decode(payload, r.epoch, r.ticket);
+        replayed.push_back(std::move(r));
+    });
+    std::stable_sort(replayed.begin(), replayed.end(), [](const Replayed& a, const Replayed& b) {
+        return a.epoch != b.epoch ? a.epoch < b.epoch : a.ticket < b.ticket;
+    });
+
+    std::vector<UpdateTask> batch;
+    for (auto& r : replayed) {
+        epoch_ = std::max(epoch_, r.epoch);
+        batch.push_back(std::move(r.task));
+        if (batch.size() >= max_batch_) {
+            applyBatch(batch);
+        }
+    }
+    applyBatch(batch);
+    replayed.clear();
+
+    // Tickets restart with the process, so later records sort after these
+    epoch_++;
+    wal_.open();
+    task_queue_.reopen();
+
+    worker_thread_ = std::thread(&RealtimeUpdater::processTasks, this);
+    std::unique_lock<std::shared_mutex> gate(enqueue_gate_);
+    running_ = true;
+}
+
+void RealtimeUpdater::stop() {
+    if (!running_) return;
+    {
+        // Producers in flight finish pushing and logging first (a blocked
+        // one waits for the worker to make room); later ones are refused
+        std::unique_lock<std::shared_mutex> gate(enqueue_gate_);
+        running_ = false;
+        task_queue_.close();
+    }
+
+    // The worker drains what was accepted before the log is closed
+    worker_thread_.join();
+    wal_.close();
+}
+
+void RealtimeUpdater::checkpoint() {
+    // Lock order is gate then apply; the worker only pops under apply
+    std::unique_lock<std::shared_mutex> gate(enqueue_gate_);
+    std::lock_guard<std::mutex> apply_lock(apply_mutex_);
+
+    std::vector<UpdateTask> pending;
+    task_queue_.popBatch(pending, task_queue_.capacity());
+    uint64_t first_live_file = wal_.rotate();
+    gate.unlock();
+
+    applyBatch(pending);
+
+    index_manager_.save();
+    wal_.dropFilesBefore(first_live_file);
+}
+
+void RealtimeUpdater::setBatchPolicy(size_t max_batch, std::chrono::milliseconds refresh_interval) {
+    std::lock_guard<std::mutex> lock(policy_mutex_);
+    max_batch_ = std::max<size_t>(1, max_batch);
+    refresh_interval_ = refresh_interval;
+}
+
+RealtimeUpdater::QueueStats RealtimeUpdater::getQueueStats() const {
+    return task_queue_.stats();
+}
+
+void RealtimeUpdater::processTasks() {
+    std::vector<UpdateTask> batch;
+
+    while (true) {
+        if (task_queue_.size() == 0) {
+            if (task_queue_.closed()) return;
+            task_queue_.waitForItems(1, std::chrono::steady_clock::now() + std::chrono::seconds(1));
+            continue;
+        }
+
+        size_t max_batch;
+        std::chrono::milliseconds refresh_interval;
+        {
+            std::lock_guard<std::mutex> lock(policy_mutex_);
+            max_batch = max_batch_;
+            refresh_interval = refresh_interval_;
+        }
+
+        // Give later updates to the same URLs a chance to coalesce
+        task_queue_.waitForItems(max_batch, std::chrono::steady_clock::now() + refresh_interval);
+
+        std::lock_guard<std::mutex> apply_lock(apply_mutex_);
+        batch.clear();
+        task_queue_.popBatch(batch, max_batch);
+        applyBatch(batch);
+    }
+}
+
+// Coalesces per URL so only the last task wins: an ADD followed by a
+// DELETE never reaches the index, and repeated updates are applied once.
+void RealtimeUpdater::applyBatch(std::vector<UpdateTask>& tasks) {
+    if (tasks.empty()) return;
+
+    std::unordered_map<std::string, size_t> last;
+    last.reserve(tasks.size());
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        last[tasks[i].doc.url] = i;
+    }
+
+    std::vector<InvertedIndex::Document> upserts;
+    std::vector<std::string> deletes;
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        if (last[tasks[i].doc.url] != i) continue;
+        if (tasks[i].type == DELETE) {
+            deletes.push_back(std::move(tasks[i].doc.url));
+        } else {
+            upserts.push_back(std::move(tasks[i].doc));
+        }
+    }
+
+    index_manager_.applyBatch(std::move(upserts), deletes);
+    tasks.clear();
+}
+
+// Body: type byte, then length-prefixed url, title, terms and content. The WAL
+// record prefixes it with the producer epoch and queue ticket. Terms are
+// logged as bytes since ids only hold within one process.
+std::string RealtimeUpdater::encode(const UpdateTask& task) {
+    std::string out;
+    out.push_back(static_cast<char>(task.type));
+
+    auto put = [&out](std::string_view s) {
+        SegmentFormat::writeVarint(out, s.size());
+        out += s;
+    };
+    put(task.doc.url);
+    put(task.doc.title);
+    const TermDictionary& dictionary = TermDictionary::shared();
+    SegmentFormat::writeVarint(out, task.doc.terms.size());
+    for (uint32_t term : task.doc.terms) {
+        put(term == TermDictionary::kNoTerm ? std::string_view() : dictionary.term(term));
+    }
+    put(task.doc.content);
+    return out;
+}
+
+RealtimeUpdater::UpdateTask RealtimeUpdater::decode(const std::string& payload,
+                                                    uint64_t& epoch, uint64_t& ticket) {
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(payload.data());
+    const uint8_t* end = p + payload.size();
+
+    // A record can pass its CRC and still be truncated or inconsistent,
+    // so every read is bounded by the payload
+    auto malformed = [] { return std::runtime_error("Malformed WAL record"); };
+    auto byte = [&]() {
+        if (p >= end) throw malformed();
+        return *p++;
+    };
+    auto varint = [&]() {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            uint8_t b = byte();
+            value |= static_cast<uint64_t>(b & 0x7f) << shift;
+            if (!(b & 0x80)) return value;
+        }
+        throw malformed();
+    };
+    auto get = [&]() {
+        uint64_t len = varint();
+        if (static_cast<uint64_t>(end - p) < len) throw malformed();
+        std::string s(reinterpret_cast<const char*>(p), len);
+        p += len;
+        return s;
+    };
+
+    epoch = varint();
+    ticket = varint();
+
+    UpdateTask task;
+    uint8_t type = byte();
+    if (type > DELETE) throw malformed();
+    task.type = static_cast<UpdateType>(type);
+    task.doc.id = 0;
+    task.doc.url = get();
+    task.doc.title = get();
+    uint64_t count = varint();
+    // Each term takes at least its length byte
+    if (count > static_cast<uint64_t>(end - p)) throw malformed();
+    TermDictionary& dictionary = TermDictionary::shared();
+    task.doc.terms.reserve(count);
+    for (uint64_t i = 0; i < count; ++i) {
+        std::string term = get();
+        task.doc.terms.push_back(term.empty() ? TermDictionary::kNoTerm : dictionary.intern(term));
+    }
+    task.doc.content = get();
+    return task;
+}
@@ -1,33 +1,72 @@
 #pragma once
-#include <queue>
 #include <thread>
 #include <mutex>
-#include <condition_variable>
-#include "search/inverted_index.h"
+#include <shared_mutex>
+#include "index_manager.h"
+#include "storage/write_ahead_log.h"
+#include "utils/mpsc_queue.h"
 
 class RealtimeUpdater {
 public:
     enum UpdateType { ADD, UPDATE, DELETE };
-    
+
     struct UpdateTask {
         UpdateType type;
         InvertedIndex::Document doc;
     };
-    
-    RealtimeUpdater(IndexManager& manager);
+
+    // What a producer does when the ingest queue is full: wait for the
+    // indexer, give up and keep the task, or drop it
+    enum EnqueueMode { BLOCK, TRY, SHED };
+
+    using QueueStats = MpscQueue<UpdateTask>::Stats;
+
+    // Every accepted task is logged to the WAL in wal_path. start()
+    // replays the WAL on top of whatever the manager has loaded. At most
+    // queue_capacity tasks wait for the indexer at any time.
+    RealtimeUpdater(IndexManager& manager, const std::string& wal_path,
+                    size_t group_commit_bytes = 1 << 20,
+                    std::chrono::milliseconds group_commit_delay = std::chrono::milliseconds(5),
+                    size_t queue_capacity = 1 << 16);
     ~RealtimeUpdater();
-    
-    void enqueue(const UpdateTask& task);
+
+    // Moves the task into the queue. Returns the WAL sequence number, or 0
+    // if the task was not accepted (queue full in TRY/SHED mode, or the
+    // updater stopped); with TRY the task is left untouched in that case.
+    // The task survives a crash once waitDurable() for it returns.
+    uint64_t enqueue(UpdateTask&& task, EnqueueMode mode = BLOCK);
+    void waitDurable(uint64_t lsn);
     void start();
     void stop();
 
+    // Persists the index and drops the WAL files it now covers
+    void checkpoint();
+
+    // The worker collects tasks for up to refresh_interval (or until
+    // max_batch are queued), coalesces them per URL and applies them as
+    // one batch. The interval bounds how long an update stays invisible.
+    void setBatchPolicy(size_t max_batch, std::chrono::milliseconds refresh_interval);
+
+    // Queue depth, rejected/shed counts and time producers spent blocked
+    QueueStats getQueueStats() const;
+
 private:
     IndexManager& index_manager_;
-    std::queue<UpdateTask> task_queue_;
-    std::mutex queue_mutex_;
-    std::condition_variable queue_cv_;
+    WriteAheadLog wal_;
+    MpscQueue<UpdateTask> task_queue_;
+    // Producers hold it shared while queueing and logging a task;
+    // checkpoint() holds it exclusively to drain and rotate
+    std::shared_mutex enqueue_gate_;
+    std::mutex apply_mutex_;
+    std::mutex policy_mutex_;
     std::thread worker_thread_;
     bool running_ = false;
-    
+    uint64_t epoch_ = 0;
+    size_t max_batch_ = 4096;
+    std::chrono::milliseconds refresh_interval_{200};
+
     void processTasks();
-}; 
\ No newline at end of file
+    void applyBatch(std::vector<UpdateTask>& tasks);
+    static std::string encode(const UpdateTask& task);
+    static UpdateTask decode(const std::string& payload, uint64_t& epoch, uint64_t& ticket);
+};
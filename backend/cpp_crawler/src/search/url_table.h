@@ -0,0 +1,463 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// URL -> document id map sized for hundreds of millions of URLs.
+//
+// The bulk of the entries live in a sorted, front-coded string table
+// (buckets of kBucketSize URLs, each storing only the suffix that differs
+// from its predecessor). An open-addressing table keyed by a 64-bit URL
+// fingerprint maps into that table in O(1); each slot holds a 32-bit
+// position plus a 16-bit tag, so most mismatches never decode a bucket.
+// Recent inserts go to a small ordered overlay. Once its bytes pass an
+// eighth of the table's, within fixed bounds, the overlay is frozen and
+// merged with the table into a new one a few buckets per insert, while a
+// fresh overlay takes the inserts; no single call rebuilds or sorts the
+// whole table.
+// Doc ids are stored in 32 bits; insert rejects any id that does not fit
+// below the erased marker.
+class UrlTable {
+public:
+    static constexpr size_t npos = SIZE_MAX;
+
+    size_t find(const std::string& url) const {
+        const uint32_t* id = locate(*this, url);
+        return id && *id != kErased ? *id : npos;
+    }
+
+    void insert(const std::string& url, size_t doc_id) {
+        if (doc_id >= kErased) {
+            throw std::out_of_range("UrlTable: doc id " + std::to_string(doc_id) +
+                                    " does not fit in 32 bits");
+        }
+        if (uint32_t* id = locate(*this, url)) {
+            if (*id == kErased) live_++;
+            *id = static_cast<uint32_t>(doc_id);
+        } else {
+            overlay_.emplace(url, static_cast<uint32_t>(doc_id));
+            overlay_bytes_ += overlayEntryBytes(url);
+            live_++;
+        }
+
+        if (merge_) {
+            // Falling behind the overlay would let it grow without bound
+            if (overlay_bytes_ > overlayBudget()) {
+                finishMerge();
+            } else {
+                mergeStep(merge_->rate);
+            }
+        }
+        if (!merge_ && overlay_bytes_ > overlayBudget()) {
+            startMerge();
+        }
+    }
+
+    bool erase(const std::string& url) {
+        auto it = overlay_.find(url);
+        if (it != overlay_.end()) {
+            overlay_.erase(it);
+            overlay_bytes_ -= overlayEntryBytes(url);
+            live_--;
+            return true;
+        }
+
+        uint32_t* id = locate(*this, url);
+        if (!id || *id == kErased) {
+            return false;
+        }
+        *id = kErased;
+        live_--;
+        return true;
+    }
+
+    void clear() {
+        *this = UrlTable();
+    }
+
+    size_t size() const {
+        return live_;
+    }
+
+    // Approximate heap footprint, for capacity planning
+    size_t memoryUsage() const {
+        size_t bytes = table_.memoryUsage() + overlay_bytes_;
+        if (merge_) {
+            bytes += merge_->builder.memoryUsage() + merge_->frozen_bytes;
+        }
+        return bytes;
+    }
+
+    // Merges every pending entry into the front-coded table now, e.g.
+    // after a bulk load. Only the old and the new compact tables are
+    // held at once, never the URLs as strings.
+    void compact() {
+        finishMerge();
+        if (!overlay_.empty()) {
+            startMerge();
+            finishMerge();
+        }
+    }
+
+    static uint64_t fingerprint(const std::string& url) {
+        // FNV-1a followed by a 64-bit finalizer to spread the low bits
+        uint64_t h = 1469598103934665603ULL;
+        for (unsigned char c : url) {
+            h ^= c;
+            h *= 1099511628211ULL;
+        }
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+private:
+    static constexpr size_t kBucketSize = 16;
+    static constexpr size_t kMinOverlayBytes = size_t(256) << 10;
+    static constexpr size_t kMaxOverlayBytes = size_t(64) << 20;
+    static constexpr size_t kMinMergeRate = 4 * kBucketSize;
+    static constexpr size_t kBlockBytes = size_t(1) << 20;
+    static constexpr uint32_t kErased = UINT32_MAX;
+
+    // Ordered, so a frozen overlay is merged without sorting it first
+    using Overlay = std::map<std::string, uint32_t>;
+
+    struct FreeDeleter {
+        void operator()(void* p) const { std::free(p); }
+    };
+
+    // calloc takes large blocks straight from fresh zero pages, so a new
+    // fingerprint index costs no pass over its memory
+    template <typename T>
+    static std::unique_ptr<T[], FreeDeleter> zeroed(size_t count) {
+        T* data = static_cast<T*>(std::calloc(count, sizeof(T)));
+        if (!data) throw std::bad_alloc();
+        return std::unique_ptr<T[], FreeDeleter>(data);
+    }
+
+    // A sorted front-coded table with its fingerprint index. The coded
+    // URLs are kept in blocks that are never reallocated once full, so a
+    // growing table never copies them; a bucket lies within one block.
+    struct Table {
+        std::vector<std::string> blocks;
+        size_t blob_bytes = 0;
+        std::vector<uint64_t> bucket_offsets;   // block << 32 | offset
+        std::vector<uint32_t> doc_ids;
+        std::unique_ptr<uint32_t[], FreeDeleter> slots;   // position + 1, 0 = empty
+        std::unique_ptr<uint16_t[], FreeDeleter> tags;
+        size_t slot_count = 0;
+
+        size_t bytes() const {
+            return blob_bytes + doc_ids.size() * sizeof(uint32_t) +
+                   slot_count * (sizeof(uint32_t) + sizeof(uint16_t));
+        }
+
+        size_t memoryUsage() const {
+            size_t bytes = 0;
+            for (const auto& block : blocks) bytes += block.capacity();
+            return bytes
+                + bucket_offsets.capacity() * sizeof(uint64_t)
+                + doc_ids.capacity() * sizeof(uint32_t)
+                + slot_count * (sizeof(uint32_t) + sizeof(uint16_t));
+        }
+
+        size_t findPosition(const std::string& url) const {
+            if (slot_count == 0) return npos;
+
+            uint64_t h = fingerprint(url);
+            uint16_t tag = static_cast<uint16_t>(h >> 48);
+            size_t mask = slot_count - 1;
+
+            thread_local std::string candidate;
+            for (size_t slot = h & mask; slots[slot] != 0; slot = (slot + 1) & mask) {
+                if (tags[slot] != tag) continue;
+                size_t pos = slots[slot] - 1;
+                decode(pos, candidate);
+                if (candidate == url) return pos;
+            }
+            return npos;
+        }
+
+        // Reconstruct the URL at a sorted position by walking its bucket
+        void decode(size_t pos, std::string& out) const {
+            uint64_t start = bucket_offsets[pos / kBucketSize];
+            const std::string& blob = blocks[start >> 32];
+            size_t offset = start & UINT32_MAX;
+            size_t len = readVarint(blob, offset);
+            out.assign(blob, offset, len);
+            offset += len;
+
+            for (size_t i = 0; i < pos % kBucketSize; ++i) {
+                size_t lcp = readVarint(blob, offset);
+                size_t suffix = readVarint(blob, offset);
+                out.resize(lcp);
+                out.append(blob, offset, suffix);
+                offset += suffix;
+            }
+        }
+
+        // Calls f(position, url) for every entry of a bucket in order
+        template <typename F>
+        void forEachInBucket(size_t bucket, std::string& url, F&& f) const {
+            const std::string& blob = blocks[bucket_offsets[bucket] >> 32];
+            size_t offset = bucket_offsets[bucket] & UINT32_MAX;
+            size_t end = std::min(doc_ids.size(), (bucket + 1) * kBucketSize);
+            for (size_t pos = bucket * kBucketSize; pos < end; ++pos) {
+                if (pos % kBucketSize == 0) {
+                    size_t len = readVarint(blob, offset);
+                    url.assign(blob, offset, len);
+                    offset += len;
+                } else {
+                    size_t lcp = readVarint(blob, offset);
+                    size_t suffix = readVarint(blob, offset);
+                    url.resize(lcp);
+                    url.append(blob, offset, suffix);
+                    offset += suffix;
+                }
+                f(pos, url);
+            }
+        }
+
+        static size_t readVarint(const std::string& blob, size_t& offset) {
+            size_t value = 0;
+            int shift = 0;
+            while (true) {
+                uint8_t byte = static_cast<uint8_t>(blob[offset++]);
+                value |= static_cast<size_t>(byte & 0x7f) << shift;
+                if (!(byte & 0x80)) break;
+                shift += 7;
+            }
+            return value;
+        }
+    };
+
+    // Writes a new table from URLs added in sorted order. What it has
+    // written so far can already be looked up.
+    class Builder {
+    public:
+        explicit Builder(size_t count) {
+            table_.doc_ids.reserve(count);
+            table_.bucket_offsets.reserve(count / kBucketSize + 1);
+            // Keep the load factor under ~0.8
+            size_t capacity = 16;
+            while (capacity * 4 < count * 5) capacity <<= 1;
+            table_.slots = zeroed<uint32_t>(capacity);
+            table_.tags = zeroed<uint16_t>(capacity);
+            table_.slot_count = capacity;
+        }
+
+        void add(const std::string& url, uint32_t doc_id) {
+            size_t pos = table_.doc_ids.size();
+            entry_.clear();
+            if (pos % kBucketSize == 0) {
+                writeVarint(entry_, url.size());
+                entry_ += url;
+            } else {
+                size_t lcp = 0;
+                size_t max_lcp = std::min(prev_.size(), url.size());
+                while (lcp < max_lcp && prev_[lcp] == url[lcp]) lcp++;
+                writeVarint(entry_, lcp);
+                writeVarint(entry_, url.size() - lcp);
+                entry_.append(url, lcp, std::string::npos);
+            }
+            append(pos % kBucketSize == 0);
+            table_.doc_ids.push_back(doc_id);
+            prev_ = url;
+
+            size_t mask = table_.slot_count - 1;
+            uint64_t h = fingerprint(url);
+            size_t slot = h & mask;
+            while (table_.slots[slot] != 0) slot = (slot + 1) & mask;
+            table_.slots[slot] = static_cast<uint32_t>(pos + 1);
+            table_.tags[slot] = static_cast<uint16_t>(h >> 48);
+        }
+
+        Table& table() { return table_; }
+        const Table& table() const { return table_; }
+        size_t memoryUsage() const { return table_.memoryUsage(); }
+
+        Table finish() {
+            return std::move(table_);
+        }
+
+    private:
+        Table table_;
+        std::string prev_;
+        std::string entry_;
+        size_t bucket_start_ = 0;
+
+        // Appends entry_ to the current bucket, or to a new one. A bucket
+        // that would overflow its block moves to a fresh block, unless it
+        // already fills one by itself.
+        void append(bool new_bucket) {
+            if (table_.blocks.empty()) addBlock();
+            std::string* block = &table_.blocks.back();
+            size_t start = new_bucket ? block->size() : bucket_start_;
+            if (block->size() + entry_.size() > kBlockBytes && start > 0) {
+                std::string bucket = block->substr(start);
+                block->resize(start);
+                block = addBlock();
+                *block += bucket;
+                start = 0;
+            }
+            uint64_t offset = (uint64_t(table_.blocks.size() - 1) << 32) | start;
+            if (new_bucket) {
+                table_.bucket_offsets.push_back(offset);
+            } else {
+                table_.bucket_offsets.back() = offset;
+            }
+            bucket_start_ = start;
+            *block += entry_;
+            table_.blob_bytes += entry_.size();
+        }
+
+        std::string* addBlock() {
+            table_.blocks.emplace_back();
+            table_.blocks.back().reserve(kBlockBytes);
+            return &table_.blocks.back();
+        }
+    };
+
+    // A merge of the table with a frozen overlay into a new table, in
+    // URL order. URLs up to `visited` are settled in the builder; the
+    // ones after it still live in the old table or the frozen overlay.
+    // Neither ever holds a URL the other has, even erased.
+    struct Merge {
+        explicit Merge(size_t count) : builder(count) {}
+
+        Builder builder;
+        Overlay frozen;              // erased entries hold kErased; merged ones are dropped
+        size_t frozen_bytes = 0;
+        Overlay::iterator next_frozen;
+        size_t next_bucket = 0;
+        std::string visited;
+        bool started = false;
+        size_t rate = kMinMergeRate;  // entries to merge per insert
+
+        bool passed(const std::string& url) const {
+            return started && url <= visited;
+        }
+    };
+
+    Table table_;
+    Overlay overlay_;
+    size_t overlay_bytes_ = 0;
+    std::unique_ptr<Merge> merge_;
+    size_t live_ = 0;
+
+    static size_t overlayEntryBytes(const std::string& url) {
+        return sizeof(Overlay::value_type) + url.size() + 4 * sizeof(void*);
+    }
+
+    // An eighth of the compact table, within fixed bounds
+    size_t overlayBudget() const {
+        return std::clamp(table_.bytes() / 8, kMinOverlayBytes, kMaxOverlayBytes);
+    }
+
+    // The id slot of url wherever it currently lives, or nullptr. The
+    // slot holds kErased for an erased entry the tables still have.
+    template <typename Self>
+    static auto locate(Self& self, const std::string& url) -> decltype(&self.table_.doc_ids[0]) {
+        auto it = self.overlay_.find(url);
+        if (it != self.overlay_.end()) {
+            return &it->second;
+        }
+        if (self.merge_) {
+            if (self.merge_->passed(url)) {
+                auto& merged = self.merge_->builder.table();
+                size_t pos = merged.findPosition(url);
+                return pos == npos ? nullptr : &merged.doc_ids[pos];
+            }
+            auto frozen = self.merge_->frozen.find(url);
+            if (frozen != self.merge_->frozen.end()) {
+                return &frozen->second;
+            }
+        }
+        size_t pos = self.table_.findPosition(url);
+        return pos == npos ? nullptr : &self.table_.doc_ids[pos];
+    }
+
+    void startMerge() {
+        merge_ = std::make_unique<Merge>(table_.doc_ids.size() + overlay_.size());
+        merge_->frozen = std::move(overlay_);
+        merge_->frozen_bytes = overlay_bytes_;
+        merge_->next_frozen = merge_->frozen.begin();
+        overlay_ = Overlay();
+        overlay_bytes_ = 0;
+
+        // Aim to be done when the new overlay is half full, assuming its
+        // entries are the size of the frozen ones
+        size_t frozen = merge_->frozen.size();
+        size_t entry_bytes = merge_->frozen_bytes / std::max<size_t>(1, frozen);
+        size_t inserts = overlayBudget() / 2 / std::max<size_t>(1, entry_bytes);
+        size_t entries = table_.doc_ids.size() + frozen;
+        merge_->rate = std::max(kMinMergeRate, entries / std::max<size_t>(1, inserts) + 1);
+    }
+
+    // Merges whole buckets of the old table, with the frozen entries
+    // that sort before them, then the frozen tail, until about `entries`
+    // have been visited
+    void mergeStep(size_t entries) {
+        Merge& merge = *merge_;
+        size_t visited = 0;
+        // Lookups of merged URLs go to the builder, so the frozen copy
+        // can be freed right away
+        auto addFrozen = [&] {
+            auto entry = merge.next_frozen;
+            if (entry->second != kErased) merge.builder.add(entry->first, entry->second);
+            merge.frozen_bytes -= overlayEntryBytes(entry->first);
+            merge.next_frozen = merge.frozen.erase(entry);
+            visited++;
+        };
+
+        std::string url;
+        while (visited < entries) {
+            if (merge.next_bucket < table_.bucket_offsets.size()) {
+                table_.forEachInBucket(merge.next_bucket++, url, [&](size_t pos, const std::string& entry) {
+                    while (merge.next_frozen != merge.frozen.end() &&
+                           merge.next_frozen->first < entry) {
+                        addFrozen();
+                    }
+                    if (table_.doc_ids[pos] != kErased) merge.builder.add(entry, table_.doc_ids[pos]);
+                    visited++;
+                });
+                merge.visited = url;
+            } else if (merge.next_frozen != merge.frozen.end()) {
+                merge.visited = merge.next_frozen->first;
+                addFrozen();
+            } else {
+                break;
+            }
+            merge.started = true;
+        }
+
+        if (merge.next_bucket == table_.bucket_offsets.size() &&
+            merge.next_frozen == merge.frozen.end()) {
+            table_ = merge.builder.finish();
+            merge_.reset();
+        }
+    }
+
+    void finishMerge() {
+        if (merge_) mergeStep(SIZE_MAX);
+    }
+
+    static void writeVarint(std::string& blob, size_t value) {
+        while (value >= 0x80) {
+            blob.push_back(static_cast<char>((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        blob.push_back(static_cast<char>(value));
+    }
+};
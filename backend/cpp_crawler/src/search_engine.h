@@ -1,5 +1,6 @@
 #pragma once
 
+#include "search/index_snapshot.h"
 #include "search/inverted_index.h"
 #include "search/ranker.h"
 #include "crawler/crawler.h"
@@ -7,14 +8,24 @@
 
 class SearchEngine {
 public:
-    SearchEngine() : index_(std::make_unique<InvertedIndex>()) {}
+    // The analyzer is shared by the crawler, the in-memory index and
+    // every query, so documents and queries are analyzed alike
+    explicit SearchEngine(const Analyzer& analyzer = Analyzer())
+        : analyzer_(analyzer), index_(std::make_unique<InvertedIndex>()), crawler_(1000, analyzer_) {
+        index_->setAnalyzer(analyzer_);
+    }
     
     void crawl(const std::vector<std::string>& seed_urls) {
         crawler_.start(seed_urls);
     }
     
     std::vector<InvertedIndex::Document> search(const std::string& query) {
-        auto terms = TextParser::tokenize(query);
+        // Each query pins the snapshot it started on
+        if (auto snapshot = getSnapshot()) {
+            return snapshot->search(query);
+        }
+        
+        auto terms = analyzer_.queryTermIds(query, TermDictionary::shared());
         auto results = Ranker::rank(terms, *index_, index_->getDocumentCount());
         
         std::vector<InvertedIndex::Document> docs;
@@ -25,7 +36,21 @@ public:
         return docs;
     }
     
+    // Serves queries from the snapshot from now on and returns the one it
+    // replaces; that one is unmapped once its last query drops it.
+    std::shared_ptr<const IndexSnapshot> swapSnapshot(std::shared_ptr<const IndexSnapshot> next) {
+        return std::atomic_exchange(&snapshot_, std::move(next));
+    }
+    
+    std::shared_ptr<const IndexSnapshot> getSnapshot() const {
+        return std::atomic_load(&snapshot_);
+    }
+    
+    const Analyzer& analyzer() const { return analyzer_; }
+    
 private:
+    Analyzer analyzer_;
     std::unique_ptr<InvertedIndex> index_;
+    std::shared_ptr<const IndexSnapshot> snapshot_;
     Crawler crawler_;
 }; 
\ No newline at end of file
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// LRU cache of decompressed blocks, bounded by total bytes. Blocks are
+// handed out as shared pointers, so an evicted block stays valid for a
+// reader that is still decoding it. Owners are identified by a number from
+// newOwner() rather than by address, which may be reused.
+class BlockCache {
+public:
+    using Block = std::shared_ptr<const std::string>;
+
+    struct Stats {
+        uint64_t hits;
+        uint64_t misses;
+        size_t blocks;
+        size_t bytes;
+        size_t capacity;
+    };
+
+    explicit BlockCache(size_t capacity_bytes) : capacity_(capacity_bytes) {}
+
+    // Process-wide cache shared by every segment
+    static BlockCache& shared() {
+        static BlockCache cache(size_t(32) << 20);
+        return cache;
+    }
+
+    static uint64_t newOwner() {
+        static std::atomic<uint64_t> next{1};
+        return next.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Returns the cached block or stores and returns load()'s result.
+    // load() runs without the lock held.
+    template <typename F>
+    Block getOrLoad(uint64_t owner, uint64_t block, F&& load) {
+        Key key{owner, block};
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = map_.find(key);
+            if (it != map_.end()) {
+                lru_.splice(lru_.begin(), lru_, it->second);
+                hits_++;
+                return it->second->data;
+            }
+            misses_++;
+        }
+
+        Block data = std::make_shared<const std::string>(load());
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = map_.find(key);
+        if (it != map_.end()) {
+            return it->second->data;  // another reader loaded it meanwhile
+        }
+        lru_.push_front({key, data});
+        map_[key] = lru_.begin();
+        bytes_ += data->size();
+        evictLocked();
+        return data;
+    }
+
+    // Drops every block of an owner that is going away
+    void erase(uint64_t owner) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto it = lru_.begin(); it != lru_.end();) {
+            if (it->key.owner == owner) {
+                bytes_ -= it->data->size();
+                map_.erase(it->key);
+                it = lru_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    void setCapacity(size_t capacity_bytes) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        capacity_ = capacity_bytes;
+        evictLocked();
+    }
+
+    Stats stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return {hits_, misses_, map_.size(), bytes_, capacity_};
+    }
+
+private:
+    struct Key {
+        uint64_t owner;
+        uint64_t block;
+
+        bool operator==(const Key& other) const {
+            return owner == other.owner && block == other.block;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const {
+            return std::hash<uint64_t>()(key.owner * 0x9e3779b97f4a7c15ULL ^ key.block);
+        }
+    };
+
+    struct Entry {
+        Key key;
+        Block data;
+    };
+
+    mutable std::mutex mutex_;
+    std::list<Entry> lru_;
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> map_;
+    size_t capacity_;
+    size_t bytes_ = 0;
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+
+    void evictLocked() {
+        // The most recent block is kept even if it alone exceeds capacity
+        while (bytes_ > capacity_ && lru_.size() > 1) {
+            auto& victim = lru_.back();
+            bytes_ -= victim.data->size();
+            map_.erase(victim.key);
+            lru_.pop_back();
+        }
+    }
+};
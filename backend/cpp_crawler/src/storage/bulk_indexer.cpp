@@ -0,0 +1,287 @@
+#include "bulk_indexer.h"
+#include "disk_index.h"
+#include "../text/page_extractor.h"
+#include <algorithm>
+#include <filesystem>
+#include <stdexcept>
+#include <sys/resource.h>
+
+namespace {
+
+constexpr size_t kQueueCapacity = 1024;
+constexpr size_t kPopBatch = 256;
+
+// Rough, conservative heap footprint of a document in a run: its stored
+// fields plus, per token, a posting or position and the allocator
+// overhead of their vectors (this measured about 136 bytes per token)
+constexpr size_t kBytesPerToken = sizeof(std::string) + sizeof(InvertedIndex::Posting) + 64;
+
+size_t storedBytes(const InvertedIndex::Document& doc) {
+    return sizeof(doc) + doc.url.size() + doc.title.size() + doc.content.size() + 64;
+}
+
+// Bits per posting are averaged weighted by postings
+void addReport(DocIdReorderer::Report& total, const DocIdReorderer::Report& part) {
+    size_t postings = total.postings + part.postings;
+    if (postings > 0) {
+        total.bits_before = (total.bits_before * total.postings + part.bits_before * part.postings) / postings;
+        total.bits_after = (total.bits_after * total.postings + part.bits_after * part.postings) / postings;
+    }
+    total.documents += part.documents;
+    total.postings = postings;
+    total.seconds += part.seconds;
+}
+
+} // namespace
+
+BulkIndexer::BulkIndexer(const std::string& output_dir)
+    : BulkIndexer(output_dir, Options()) {}
+
+BulkIndexer::BulkIndexer(const std::string& output_dir, const Options& options)
+    : output_dir_(output_dir), options_(options) {
+    if (options_.threads == 0) {
+        options_.threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    if (options_.tmp_dir.empty()) {
+        options_.tmp_dir = output_dir_;
+    }
+    options_.merge_fan_in = std::max<size_t>(2, options_.merge_fan_in);
+
+    std::filesystem::create_directories(output_dir_);
+    std::filesystem::create_directories(options_.tmp_dir);
+    start();
+}
+
+BulkIndexer::~BulkIndexer() {
+    if (finished_) return;
+    stopWorkers();
+    for (const auto& worker : workers_) {
+        for (const auto& path : worker->run_files) {
+            std::filesystem::remove(path);
+        }
+    }
+}
+
+void BulkIndexer::start() {
+    started_ = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < options_.threads; ++i) {
+        workers_.push_back(std::make_unique<Worker>(kQueueCapacity));
+        workers_.back()->run.setAnalyzer(Analyzer(options_.analysis));
+    }
+    for (size_t i = 0; i < workers_.size(); ++i) {
+        workers_[i]->thread = std::thread(&BulkIndexer::workerLoop, this, i);
+    }
+}
+
+bool BulkIndexer::add(CrawlDump::Page&& page) {
+    if (finished_) {
+        throw std::logic_error("BulkIndexer::add after finish");
+    }
+    if (urls_.find(page.url) != UrlTable::npos) {
+        duplicates_++;
+        return false;
+    }
+
+    Job job;
+    job.id = next_doc_id_++;
+    urls_.insert(page.url, job.id);
+    job.page = std::move(page);
+
+    // Prefer any worker with room; wait on the next one only if all are full
+    for (size_t i = 0; i < workers_.size(); ++i) {
+        auto& worker = *workers_[(next_worker_ + i) % workers_.size()];
+        if (worker.queue.push(std::move(job), MpscQueue<Job>::TRY)) {
+            next_worker_ = (next_worker_ + i + 1) % workers_.size();
+            return true;
+        }
+    }
+
+    auto& worker = *workers_[next_worker_];
+    if (!worker.queue.push(std::move(job), MpscQueue<Job>::BLOCK)) {
+        // A worker closes its queue only when it failed
+        stopWorkers();
+        if (worker.error) std::rethrow_exception(worker.error);
+        throw std::runtime_error("Bulk indexer worker stopped");
+    }
+    next_worker_ = (next_worker_ + 1) % workers_.size();
+    return true;
+}
+
+void BulkIndexer::workerLoop(size_t index) {
+    auto& worker = *workers_[index];
+    std::vector<Job> batch;
+    std::string indexed;
+    std::string folded;
+    // Reused across this worker's pages, with the run's analyzer so the
+    // terms match the queries
+    PageExtractor extractor(worker.run.analyzer());
+    ExtractedPage extracted;
+    TermDictionary& dictionary = TermDictionary::shared();
+
+    try {
+        while (true) {
+            if (worker.queue.size() == 0) {
+                if (worker.queue.closed()) break;
+                worker.queue.waitForItems(1, std::chrono::steady_clock::now() + std::chrono::milliseconds(100));
+                continue;
+            }
+
+            batch.clear();
+            worker.queue.popBatch(batch, kPopBatch);
+            for (auto& job : batch) {
+                auto& page = job.page;
+
+                InvertedIndex::Document doc;
+                doc.id = job.id;
+                if (page.html) {
+                    extractor.extract(page.content, extracted);
+                    doc.url = std::move(page.url);
+                    doc.title = extracted.title;
+                    doc.content = extracted.text;
+
+                    // The extractor already analyzed the text; only the
+                    // title, which text leaves out, is analyzed here
+                    worker.run.analyzer().forEachTermId(doc.title, folded, dictionary,
+                        [&doc](uint32_t term, size_t) { doc.terms.push_back(term); });
+                    for (const auto& span : extracted.tokens) {
+                        doc.terms.push_back(dictionary.intern(extracted.token(span)));
+                    }
+                    worker.run_bytes += storedBytes(doc) + doc.terms.size() * kBytesPerToken;
+                    worker.run.addDocument(std::move(doc));
+                } else {
+                    indexed.assign(page.title).append("\n").append(page.content);
+                    doc.url = std::move(page.url);
+                    doc.title = std::move(page.title);
+                    doc.content = std::move(page.content);
+                    worker.run_bytes += storedBytes(doc);
+                    worker.run_bytes += worker.run.addDocument(std::move(doc), indexed) * kBytesPerToken;
+                }
+                // Terms past a full dictionary were dropped; the worker
+                // error fails the build
+                if (dictionary.full()) {
+                    throw std::length_error("Term dictionary is full");
+                }
+                if (worker.run_bytes >= options_.run_memory_bytes) {
+                    spill(index);
+                }
+            }
+        }
+
+        if (worker.run.getDocumentCount() > 0) {
+            spill(index);
+        }
+    } catch (...) {
+        worker.error = std::current_exception();
+        worker.queue.close();
+    }
+}
+
+void BulkIndexer::spill(size_t index) {
+    auto& worker = *workers_[index];
+    if (options_.reorder) {
+        // Workers already keep every core busy
+        DocIdReorderer::Options reorder;
+        reorder.threads = 1;
+        addReport(worker.reorder, DocIdReorderer::optimize(worker.run, reorder));
+    }
+
+    std::string path = runPath("run-" + std::to_string(index) + "-" +
+                               std::to_string(worker.run_count++) + ".zseg");
+
+    DiskIndex::writeSegment(path, {}, &worker.run);
+    worker.run_files.push_back(path);
+    worker.run = InvertedIndex();
+    worker.run.setAnalyzer(Analyzer(options_.analysis));
+    worker.run_bytes = 0;
+}
+
+void BulkIndexer::stopWorkers() {
+    for (auto& worker : workers_) {
+        worker->queue.close();
+    }
+    for (auto& worker : workers_) {
+        if (worker->thread.joinable()) worker->thread.join();
+    }
+}
+
+BulkIndexer::Report BulkIndexer::finish() {
+    if (finished_) {
+        throw std::logic_error("BulkIndexer::finish called twice");
+    }
+    stopWorkers();
+    finished_ = true;
+
+    std::vector<std::string> runs;
+    for (const auto& worker : workers_) {
+        if (worker->error) std::rethrow_exception(worker->error);
+        runs.insert(runs.end(), worker->run_files.begin(), worker->run_files.end());
+    }
+
+    Report report;
+    report.runs = runs.size();
+    for (const auto& worker : workers_) {
+        addReport(report.reorder, worker->reorder);
+    }
+
+    auto openAll = [](const std::vector<std::string>& paths) {
+        std::vector<std::shared_ptr<MappedSegment>> segments;
+        for (const auto& path : paths) {
+            segments.push_back(MappedSegment::open(path));
+        }
+        return segments;
+    };
+    auto removeAll = [](const std::vector<std::string>& paths) {
+        for (const auto& path : paths) {
+            std::filesystem::remove(path);
+        }
+    };
+
+    // Bound the number of open streams per merge
+    for (size_t round = 0; runs.size() > options_.merge_fan_in; ++round) {
+        std::vector<std::string> merged;
+        for (size_t i = 0; i < runs.size(); i += options_.merge_fan_in) {
+            std::vector<std::string> group(runs.begin() + i,
+                runs.begin() + std::min(runs.size(), i + options_.merge_fan_in));
+            if (group.size() == 1) {
+                merged.push_back(group[0]);
+                continue;
+            }
+
+            std::string path = runPath("merge-" + std::to_string(round) + "-" +
+                                       std::to_string(i / options_.merge_fan_in) + ".zseg");
+            {
+                auto segments = openAll(group);
+                std::vector<const MappedSegment*> sources;
+                for (const auto& segment : segments) sources.push_back(segment.get());
+                DiskIndex::writeSegment(path, sources, nullptr);
+            }
+            removeAll(group);
+            merged.push_back(path);
+        }
+        runs = std::move(merged);
+    }
+
+    {
+        auto segments = openAll(runs);
+        report.segment_bytes = DiskIndex(output_dir_).save(segments, InvertedIndex())->fileSize();
+    }
+    removeAll(runs);
+
+    auto elapsed = std::chrono::steady_clock::now() - started_;
+    report.documents = next_doc_id_;
+    report.duplicates = duplicates_;
+    report.seconds = std::chrono::duration<double>(elapsed).count();
+    report.docs_per_second = report.seconds > 0 ? report.documents / report.seconds : 0;
+    report.peak_rss_bytes = peakRss();
+    return report;
+}
+
+size_t BulkIndexer::peakRss() {
+    struct rusage usage;
+    if (::getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;  // kilobytes on Linux
+}
+
+std::string BulkIndexer::runPath(const std::string& name) const {
+    return (std::filesystem::path(options_.tmp_dir) / name).string();
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include "../search/docid_reorder.h"
+#include "../search/inverted_index.h"
+#include "../search/url_table.h"
+#include "../utils/mpsc_queue.h"
+#include "crawl_dump.h"
+#include <chrono>
+#include <exception>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Offline index build. Pages are fanned out to worker threads that
+// tokenize them into private in-memory runs; a run that outgrows its
+// memory budget is spilled as a segment file. finish() k-way merges the
+// spilled runs (in rounds of at most merge_fan_in) into the single
+// segment index that IndexManager::load() and IndexSnapshot pick up.
+// With reorder set, each run's doc ids are reassigned by DocIdReorderer
+// before it is written, so postings within a run have small d-gaps.
+class BulkIndexer {
+public:
+    struct Options {
+        size_t threads = 0;                      // 0: hardware concurrency
+        size_t run_memory_bytes = size_t(256) << 20;  // per worker
+        size_t merge_fan_in = 64;
+        std::string tmp_dir;                     // defaults to the output dir
+        Analyzer::Options analysis;              // queries must match it
+        bool reorder = false;
+    };
+
+    struct Report {
+        size_t documents = 0;
+        size_t duplicates = 0;
+        size_t runs = 0;
+        size_t segment_bytes = 0;
+        double seconds = 0;
+        double docs_per_second = 0;
+        size_t peak_rss_bytes = 0;
+        // Summed over the runs, bits weighted by postings; set with reorder
+        DocIdReorderer::Report reorder;
+    };
+
+    explicit BulkIndexer(const std::string& output_dir);
+    BulkIndexer(const std::string& output_dir, const Options& options);
+    ~BulkIndexer();
+
+    // Called from a single reader thread; blocks while every worker is
+    // backed up. Returns false for a URL that was already added.
+    bool add(CrawlDump::Page&& page);
+
+    // Drains the workers, merges all runs and removes the run files
+    Report finish();
+
+    static size_t peakRss();
+
+private:
+    struct Job {
+        size_t id = 0;
+        CrawlDump::Page page;
+    };
+
+    struct Worker {
+        explicit Worker(size_t capacity) : queue(capacity) {}
+
+        MpscQueue<Job> queue;
+        InvertedIndex run;
+        size_t run_bytes = 0;
+        size_t run_count = 0;
+        std::vector<std::string> run_files;
+        DocIdReorderer::Report reorder;
+        std::exception_ptr error;
+        std::thread thread;
+    };
+
+    std::string output_dir_;
+    Options options_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+    size_t next_worker_ = 0;
+    UrlTable urls_;
+    size_t next_doc_id_ = 0;
+    size_t duplicates_ = 0;
+    bool finished_ = false;
+    std::chrono::steady_clock::time_point started_;
+
+    void start();
+    void workerLoop(size_t index);
+    void spill(size_t index);
+    void stopWorkers();
+    std::string runPath(const std::string& name) const;
+};
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <istream>
+#include <string>
+#include <strings.h>
+
+// Readers for offline crawl dumps: the crawled_pages.txt records written by
+// FileStorage (backup/main_simple.cpp) and WARC files. Both stream records
+// to a callback so a dump never has to fit in memory.
+class CrawlDump {
+public:
+    struct Page {
+        std::string url;
+        std::string title;    // empty for html; the indexer extracts it
+        std::string content;
+        bool html = false;  // content is raw markup rather than text
+    };
+
+    // Records are "URL:", "Title:", "Content:" (possibly spanning several
+    // lines), "Depth:", "Timestamp:" and a "---" separator.
+    template <typename F>
+    static size_t readPages(std::istream& in, F&& f) {
+        size_t count = 0;
+        Page page;
+        bool in_content = false;
+        std::string line;
+
+        while (std::getline(in, line)) {
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+
+            if (line == "---") {
+                if (!page.url.empty()) {
+                    trimEllipsis(page.content);
+                    f(std::move(page));
+                    count++;
+                }
+                page = Page();
+                in_content = false;
+            } else if (startsWith(line, "URL: ")) {
+                page.url = line.substr(5);
+            } else if (startsWith(line, "Title: ")) {
+                page.title = line.substr(7);
+            } else if (startsWith(line, "Content: ")) {
+                page.content = line.substr(9);
+                in_content = true;
+            } else if (startsWith(line, "Depth: ") || startsWith(line, "Timestamp: ")) {
+                in_content = false;
+            } else if (in_content) {
+                page.content += '\n';
+                page.content += line;
+            }
+        }
+        return count;
+    }
+
+    // Yields the response and resource records of a WARC file. HTTP
+    // headers are stripped; the payload is passed on as markup.
+    template <typename F>
+    static size_t readWarc(std::istream& in, F&& f) {
+        size_t count = 0;
+        std::string line;
+
+        while (std::getline(in, line)) {
+            if (!startsWith(line, "WARC/")) continue;
+
+            std::string type;
+            std::string uri;
+            size_t length = 0;
+            while (std::getline(in, line)) {
+                if (!line.empty() && line.back() == '\r') line.pop_back();
+                if (line.empty()) break;
+
+                size_t colon = line.find(':');
+                if (colon == std::string::npos) continue;
+                std::string value = trim(line.substr(colon + 1));
+                if (headerIs(line, colon, "WARC-Type")) {
+                    type = value;
+                } else if (headerIs(line, colon, "WARC-Target-URI")) {
+                    uri = value;
+                } else if (headerIs(line, colon, "Content-Length")) {
+                    length = std::strtoull(value.c_str(), nullptr, 10);
+                }
+            }
+
+            std::string block(length, '\0');
+            in.read(&block[0], static_cast<std::streamsize>(length));
+            block.resize(static_cast<size_t>(in.gcount()));
+            if ((type != "response" && type != "resource") || uri.empty()) continue;
+
+            if (type == "response") {
+                size_t body = block.find("\r\n\r\n");
+                block.erase(0, body == std::string::npos ? block.size() : body + 4);
+            }
+
+            Page page;
+            page.url = std::move(uri);
+            page.content = std::move(block);
+            page.html = true;
+            f(std::move(page));
+            count++;
+        }
+        return count;
+    }
+
+private:
+    static bool startsWith(const std::string& s, const char* prefix) {
+        return s.rfind(prefix, 0) == 0;
+    }
+
+    static bool headerIs(const std::string& line, size_t colon, const char* name) {
+        return colon == std::char_traits<char>::length(name) &&
+            ::strncasecmp(line.c_str(), name, colon) == 0;
+    }
+
+    static std::string trim(const std::string& s) {
+        size_t b = 0, e = s.size();
+        while (b < e && std::isspace(static_cast<unsigned char>(s[b]))) b++;
+        while (e > b && std::isspace(static_cast<unsigned char>(s[e - 1]))) e--;
+        return s.substr(b, e - b);
+    }
+
+    // FileStorage truncates content to 500 bytes and appends "..."
+    static void trimEllipsis(std::string& content) {
+        if (content.size() >= 3 && content.compare(content.size() - 3, 3, "...") == 0) {
+            content.resize(content.size() - 3);
+        }
+    }
+};
@@ -0,0 +1,500 @@
+#include "disk_index.h"
+#include "segment_writer.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <queue>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_set>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr const char* kManifestMagic = "zeppa-manifest 1";
+
+// "zeppa-manifest 1", "generation N", then "segment <file> <deletes|->"
+// per segment, paths relative to the index directory
+struct Manifest {
+    uint64_t generation = 0;
+    std::vector<std::pair<std::string, std::string>> entries;
+};
+
+bool readManifest(const std::string& path, Manifest& manifest) {
+    std::ifstream in(path);
+    if (!in) return false;
+
+    std::string line;
+    if (!std::getline(in, line) || line != kManifestMagic) {
+        throw std::runtime_error("Invalid manifest: " + path);
+    }
+    while (std::getline(in, line)) {
+        std::istringstream fields(line);
+        std::string kind;
+        fields >> kind;
+        if (kind == "generation") {
+            fields >> manifest.generation;
+        } else if (kind == "segment") {
+            std::string segment, deletes;
+            fields >> segment >> deletes;
+            if (segment.empty() || deletes.empty()) {
+                throw std::runtime_error("Invalid manifest entry in " + path + ": " + line);
+            }
+            manifest.entries.push_back({segment, deletes == "-" ? "" : deletes});
+        } else if (!kind.empty()) {
+            throw std::runtime_error("Invalid manifest entry in " + path + ": " + line);
+        }
+    }
+    return true;
+}
+
+std::string readFile(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("Cannot open " + path);
+    }
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+// Write, fsync and rename over path
+void writeFileAtomically(const std::string& path, const std::string& data) {
+    std::string tmp_path = path + ".tmp";
+    int fd = ::open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot create " + tmp_path + ": " + std::strerror(errno));
+    }
+
+    const char* p = data.data();
+    size_t left = data.size();
+    while (left > 0) {
+        ssize_t n = ::write(fd, p, left);
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0) {
+            std::string error = std::strerror(errno);
+            ::close(fd);
+            ::unlink(tmp_path.c_str());
+            throw std::runtime_error("Cannot write " + tmp_path + ": " + error);
+        }
+        p += n;
+        left -= static_cast<size_t>(n);
+    }
+    if (::fsync(fd) != 0 || ::close(fd) != 0) {
+        ::unlink(tmp_path.c_str());
+        throw std::runtime_error("Cannot sync " + tmp_path);
+    }
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        ::unlink(tmp_path.c_str());
+        throw std::runtime_error("Cannot rename into place: " + path);
+    }
+}
+
+// Makes renames within the directory durable
+void syncDirectory(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd < 0) return;
+    ::fsync(fd);
+    ::close(fd);
+}
+
+// Live postings of one term from one source, in ascending doc order
+struct PostingStream {
+    const MappedSegment* segment = nullptr;
+    MappedSegment::PostingCursor cursor;
+    const InvertedIndex* memtable = nullptr;
+    std::vector<const InvertedIndex::Posting*> list;
+    size_t next_index = 0;
+    const InvertedIndex::Posting* current = nullptr;
+    size_t doc = 0;
+    bool valid = false;
+
+    bool advance() {
+        if (segment) {
+            while ((valid = cursor.next())) {
+                doc = cursor.docId();
+                if (segment->isLive(doc)) return true;
+            }
+            return false;
+        }
+        while ((valid = next_index < list.size())) {
+            current = list[next_index++];
+            doc = current->doc_id;
+            if (memtable->isLive(doc)) return true;
+        }
+        return false;
+    }
+
+    size_t frequency() const {
+        return segment ? cursor.frequency() : current->frequency;
+    }
+
+    void positions(std::vector<size_t>& out) const {
+        if (segment) {
+            cursor.positions(out);
+        } else {
+            out = current->positions;
+        }
+    }
+};
+
+struct TermHead {
+    std::string_view term;
+    size_t source;
+    size_t index;
+
+    bool operator>(const TermHead& other) const {
+        return term != other.term ? term > other.term : source > other.source;
+    }
+};
+
+struct MemtableTerm {
+    std::string_view term;
+    const std::vector<InvertedIndex::Posting>* postings;
+};
+
+// The memtable is keyed by term id; segments are ordered by term bytes
+std::vector<MemtableTerm> sortedTerms(const InvertedIndex& index) {
+    const TermDictionary& dictionary = TermDictionary::shared();
+    std::vector<MemtableTerm> terms;
+    terms.reserve(index.getTerms().size());
+    for (const auto& [id, postings] : index.getTerms()) {
+        terms.push_back({dictionary.term(id), &postings});
+    }
+    std::sort(terms.begin(), terms.end(),
+        [](const MemtableTerm& a, const MemtableTerm& b) { return a.term < b.term; });
+    return terms;
+}
+
+} // namespace
+
+DiskIndex::DiskIndex(const std::string& base_path) : base_path_(base_path) {}
+
+std::string DiskIndex::legacyPath() const {
+    return (std::filesystem::path(base_path_) / "index.zseg").string();
+}
+
+std::string DiskIndex::segmentDir() const {
+    return (std::filesystem::path(base_path_) / "segments").string();
+}
+
+std::string DiskIndex::manifestPath() const {
+    return (std::filesystem::path(base_path_) / "MANIFEST").string();
+}
+
+std::string DiskIndex::relative(const std::string& path) const {
+    return std::filesystem::path(path).lexically_relative(base_path_).string();
+}
+
+std::string DiskIndex::absolute(const std::string& relative) const {
+    return (std::filesystem::path(base_path_) / relative).string();
+}
+
+void DiskIndex::save(const InvertedIndex& index) {
+    save({}, index);
+}
+
+std::shared_ptr<MappedSegment> DiskIndex::save(
+    const std::vector<std::shared_ptr<MappedSegment>>& segments, const InvertedIndex& memtable) {
+    std::vector<const MappedSegment*> sources;
+    for (const auto& segment : segments) {
+        sources.push_back(segment.get());
+    }
+
+    std::string path = newSegmentPath();
+    writeSegment(path, sources, &memtable);
+    auto merged = MappedSegment::open(path);
+    commit({merged});
+    return merged;
+}
+
+std::string DiskIndex::newSegmentPath() {
+    std::filesystem::create_directories(segmentDir());
+
+    // Skip names left by an earlier process
+    std::filesystem::path path;
+    do {
+        path = std::filesystem::path(segmentDir()) /
+               ("seg-" + std::to_string(next_segment_++) + ".zseg");
+    } while (std::filesystem::exists(path));
+    return path.string();
+}
+
+void DiskIndex::commit(const std::vector<std::shared_ptr<MappedSegment>>& segments) {
+    std::filesystem::create_directories(segmentDir());
+    uint64_t generation = generation_ + 1;
+
+    std::unordered_map<std::string, Committed> next;
+    std::vector<std::string> obsolete;
+    std::string manifest = std::string(kManifestMagic) + "\ngeneration " +
+                           std::to_string(generation) + "\n";
+
+    for (const auto& segment : segments) {
+        std::string name = relative(segment->path());
+        auto it = committed_.find(name);
+        Committed entry = it != committed_.end() ? it->second : Committed();
+
+        const auto& live_docs = segment->getLiveDocs();
+        if (live_docs.deletedCount() != entry.deleted_count) {
+            // A fresh name per generation keeps the previous manifest's
+            // bitmap intact until the new manifest is in place
+            std::string deletes = (std::filesystem::path(name).parent_path() /
+                (std::filesystem::path(name).stem().string() + "." +
+                 std::to_string(generation) + ".del")).string();
+            writeFileAtomically(absolute(deletes), live_docs.serialize());
+            if (!entry.deletes.empty()) obsolete.push_back(entry.deletes);
+            entry.deletes = deletes;
+            entry.deleted_count = live_docs.deletedCount();
+        }
+
+        manifest += "segment " + name + " " + (entry.deletes.empty() ? "-" : entry.deletes) + "\n";
+        next[name] = entry;
+    }
+    for (const auto& [name, entry] : committed_) {
+        if (next.count(name)) continue;
+        obsolete.push_back(name);
+        if (!entry.deletes.empty()) obsolete.push_back(entry.deletes);
+    }
+
+    // Segment files and bitmaps must be durable before a manifest names them
+    syncDirectory(segmentDir());
+    writeFileAtomically(manifestPath(), manifest);
+    syncDirectory(base_path_);
+
+    committed_ = std::move(next);
+    generation_ = generation;
+    for (const auto& name : obsolete) {
+        std::filesystem::remove(absolute(name));
+    }
+}
+
+void DiskIndex::release(const std::string& path) {
+    if (!committed_.count(relative(path))) {
+        std::filesystem::remove(path);
+    }
+}
+
+std::shared_ptr<MappedSegment> DiskIndex::openCommitted(const std::string& segment,
+                                                        const std::string& deletes) const {
+    auto mapped = MappedSegment::open(absolute(segment));
+    if (!deletes.empty()) {
+        LiveDocs::deserialize(readFile(absolute(deletes))).forEachDeleted([&](size_t id) {
+            mapped->removeDocument(id);
+        });
+    }
+    return mapped;
+}
+
+std::vector<std::shared_ptr<MappedSegment>> DiskIndex::openAll() {
+    std::vector<std::shared_ptr<MappedSegment>> segments;
+    committed_.clear();
+    generation_ = 0;
+
+    Manifest manifest;
+    if (readManifest(manifestPath(), manifest)) {
+        generation_ = manifest.generation;
+        for (const auto& [segment, deletes] : manifest.entries) {
+            auto mapped = openCommitted(segment, deletes);
+            committed_[segment] = {mapped->getLiveDocs().deletedCount(), deletes};
+            segments.push_back(std::move(mapped));
+        }
+    } else if (std::filesystem::exists(legacyPath())) {
+        auto mapped = MappedSegment::open(legacyPath());
+        committed_[relative(legacyPath())] = {};
+        segments.push_back(std::move(mapped));
+    }
+
+    std::unordered_set<std::string> referenced;
+    for (const auto& [name, entry] : committed_) {
+        referenced.insert(name);
+        referenced.insert(entry.deletes);
+    }
+    std::error_code ec;
+    for (const auto& file : std::filesystem::directory_iterator(segmentDir(), ec)) {
+        if (!referenced.count(relative(file.path().string()))) {
+            std::filesystem::remove(file.path(), ec);
+        }
+    }
+    return segments;
+}
+
+std::shared_ptr<MappedSegment> DiskIndex::open() const {
+    Manifest manifest;
+    if (readManifest(manifestPath(), manifest)) {
+        if (manifest.entries.empty()) return nullptr;
+        if (manifest.entries.size() > 1) {
+            throw std::runtime_error("Index has " + std::to_string(manifest.entries.size()) +
+                                     " segments, expected one: " + base_path_);
+        }
+        return openCommitted(manifest.entries[0].first, manifest.entries[0].second);
+    }
+    if (!std::filesystem::exists(legacyPath())) {
+        return nullptr;
+    }
+    return MappedSegment::open(legacyPath());
+}
+
+void DiskIndex::load(InvertedIndex& index) {
+    // Term sequences are not stored; rebuild them from term positions,
+    // interning each segment term once
+    TermDictionary& dictionary = TermDictionary::shared();
+    std::vector<size_t> positions;
+    for (const auto& segment : openAll()) {
+        std::vector<InvertedIndex::Document> docs(segment->getStoredDocumentCount());
+        for (size_t i = 0; i < docs.size(); ++i) {
+            docs[i].id = segment->docIdAt(i);
+            if (!segment->isLive(docs[i].id)) continue;
+            docs[i].url = std::string(segment->urlAt(i));
+            docs[i].title = std::string(segment->titleAt(i));
+            docs[i].content = segment->getContent(docs[i].id);
+            docs[i].terms.assign(segment->normAt(i), TermDictionary::kNoTerm);
+        }
+
+        for (size_t t = 0; t < segment->getTermCount(); ++t) {
+            uint32_t term = dictionary.intern(segment->termAt(t));
+            auto cursor = segment->postingsAt(t);
+            while (cursor.next()) {
+                auto& doc = docs[segment->findDocument(cursor.docId())];
+                cursor.positions(positions);
+                for (size_t pos : positions) {
+                    if (pos < doc.terms.size()) doc.terms[pos] = term;
+                }
+            }
+        }
+
+        // A replaced document is deleted from its older segment, so each
+        // id is live in at most one of them
+        for (auto& doc : docs) {
+            if (segment->isLive(doc.id)) index.addDocument(std::move(doc));
+        }
+    }
+}
+
+void DiskIndex::writeSegment(const std::string& path,
+                             const std::vector<const MappedSegment*>& segments,
+                             const InvertedIndex* memtable,
+                             const std::function<void(size_t)>& on_write) {
+    SegmentWriter writer(path);
+    if (on_write) {
+        writer.setWriteHook(on_write);
+    }
+    writeDocuments(writer, segments, memtable);
+    writePostings(writer, segments, memtable);
+    writer.finish();
+}
+
+void DiskIndex::writeDocuments(SegmentWriter& writer,
+                               const std::vector<const MappedSegment*>& segments,
+                               const InvertedIndex* memtable) {
+    struct DocRef {
+        size_t id;
+        const MappedSegment* segment;
+        size_t index;
+        const InvertedIndex::Document* doc;
+    };
+
+    std::vector<DocRef> refs;
+    for (const auto* segment : segments) {
+        for (size_t i = 0; i < segment->getStoredDocumentCount(); ++i) {
+            size_t id = segment->docIdAt(i);
+            if (segment->isLive(id)) refs.push_back({id, segment, i, nullptr});
+        }
+    }
+    if (memtable) {
+        for (const auto& [id, doc] : memtable->getDocuments()) {
+            if (memtable->isLive(id)) refs.push_back({id, nullptr, 0, &doc});
+        }
+    }
+
+    std::sort(refs.begin(), refs.end(),
+        [](const DocRef& a, const DocRef& b) { return a.id < b.id; });
+
+    for (const auto& ref : refs) {
+        if (ref.segment) {
+            writer.addDocument(ref.id, std::string(ref.segment->urlAt(ref.index)),
+                               std::string(ref.segment->titleAt(ref.index)),
+                               ref.segment->normAt(ref.index),
+                               ref.segment->getContent(ref.id));
+        } else {
+            writer.addDocument(ref.id, ref.doc->url, ref.doc->title,
+                               ref.doc->length, ref.doc->content);
+        }
+    }
+}
+
+void DiskIndex::writePostings(SegmentWriter& writer,
+                              const std::vector<const MappedSegment*>& segments,
+                              const InvertedIndex* memtable) {
+    std::vector<MemtableTerm> memtable_terms;
+    if (memtable) {
+        memtable_terms = sortedTerms(*memtable);
+    }
+
+    // k-way merge of the sorted term dictionaries; source == segments.size()
+    // is the memtable
+    std::priority_queue<TermHead, std::vector<TermHead>, std::greater<TermHead>> heads;
+    for (size_t s = 0; s < segments.size(); ++s) {
+        if (segments[s]->getTermCount() > 0) {
+            heads.push({segments[s]->termAt(0), s, 0});
+        }
+    }
+    if (!memtable_terms.empty()) {
+        heads.push({memtable_terms[0].term, segments.size(), 0});
+    }
+
+    std::vector<PostingStream> streams;
+    std::vector<size_t> positions;
+
+    while (!heads.empty()) {
+        std::string term(heads.top().term);
+        streams.clear();
+
+        while (!heads.empty() && heads.top().term == term) {
+            TermHead head = heads.top();
+            heads.pop();
+
+            PostingStream stream;
+            if (head.source < segments.size()) {
+                const auto* segment = segments[head.source];
+                stream.segment = segment;
+                stream.cursor = segment->postingsAt(head.index);
+                if (head.index + 1 < segment->getTermCount()) {
+                    heads.push({segment->termAt(head.index + 1), head.source, head.index + 1});
+                }
+            } else {
+                stream.memtable = memtable;
+                for (const auto& posting : *memtable_terms[head.index].postings) {
+                    stream.list.push_back(&posting);
+                }
+                std::sort(stream.list.begin(), stream.list.end(),
+                    [](const auto* a, const auto* b) { return a->doc_id < b->doc_id; });
+                if (head.index + 1 < memtable_terms.size()) {
+                    heads.push({memtable_terms[head.index + 1].term, head.source, head.index + 1});
+                }
+            }
+
+            if (stream.advance()) {
+                streams.push_back(std::move(stream));
+            }
+        }
+
+        writer.startTerm(term);
+        while (!streams.empty()) {
+            size_t best = 0;
+            for (size_t i = 1; i < streams.size(); ++i) {
+                if (streams[i].doc < streams[best].doc) best = i;
+            }
+
+            auto& stream = streams[best];
+            stream.positions(positions);
+            writer.addPosting(stream.doc, stream.frequency(), positions);
+
+            if (!stream.advance()) {
+                streams.erase(streams.begin() + best);
+            }
+        }
+        writer.finishTerm();
+    }
+}
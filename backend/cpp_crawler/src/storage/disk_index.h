@@ -1,18 +1,86 @@
 #pragma once
 #include "../search/inverted_index.h"
+#include "mapped_segment.h"
+#include <functional>
+#include <memory>
 #include <string>
-#include <fstream>
+#include <unordered_map>
+#include <vector>
 
+class SegmentWriter;
+
+// An index directory holds immutable segment files under segments/, one
+// deletion bitmap file per segment and checkpoint that deleted anything,
+// and a MANIFEST naming the current set. A checkpoint writes only what
+// changed and then replaces the manifest with rename(), so a crash
+// leaves either the old or the new checkpoint. Directories written
+// before manifests existed hold a single index.zseg, which is still read.
 class DiskIndex {
 public:
     DiskIndex(const std::string& base_path);
     
     void save(const InvertedIndex& index);
+    
+    // Adds the live documents of every committed segment to index, which
+    // gets them under their stored ids
     void load(InvertedIndex& index);
     
+    // Full rewrite: writes the live contents of the segments and the
+    // in-memory index as one new segment and commits it as the only one
+    std::shared_ptr<MappedSegment> save(const std::vector<std::shared_ptr<MappedSegment>>& segments,
+                                        const InvertedIndex& memtable);
+    
+    // Incremental checkpoint of exactly these segments, whose files must
+    // already be written: stores the deletion bitmaps that changed since
+    // the last commit, then the manifest. Files only the previous
+    // manifest referenced are removed afterwards.
+    void commit(const std::vector<std::shared_ptr<MappedSegment>>& segments);
+    
+    // Maps every committed segment with its deletions applied and removes
+    // files no checkpoint references (leftovers of a crash)
+    std::vector<std::shared_ptr<MappedSegment>> openAll();
+    
+    // Maps the segment of a single-segment index, such as one written by
+    // save(); nullptr if none exists
+    std::shared_ptr<MappedSegment> open() const;
+    
+    // A segment that was merged away: its file is removed now unless the
+    // last checkpoint still needs it, in which case the next commit does
+    void release(const std::string& path);
+    
+    // on_write, if set, is called with the size of each write beforehand
+    static void writeSegment(const std::string& path,
+                             const std::vector<const MappedSegment*>& segments,
+                             const InvertedIndex* memtable,
+                             const std::function<void(size_t)>& on_write = nullptr);
+    
+    // Name for a new segment file. Callers serialize this and the
+    // checkpoint methods.
+    std::string newSegmentPath();
+    
 private:
+    // What the last manifest recorded for a segment
+    struct Committed {
+        size_t deleted_count = 0;
+        std::string deletes;  // bitmap file, empty if none
+    };
+    
     std::string base_path_;
+    size_t next_segment_ = 0;
+    uint64_t generation_ = 0;
+    std::unordered_map<std::string, Committed> committed_;  // by relative path
     
-    void writePostings(std::ofstream& out, const std::vector<InvertedIndex::Posting>& postings);
-    void readPostings(std::ifstream& in, std::vector<InvertedIndex::Posting>& postings);
-}; 
\ No newline at end of file
+    std::string legacyPath() const;
+    std::string segmentDir() const;
+    std::string manifestPath() const;
+    std::string relative(const std::string& path) const;
+    std::string absolute(const std::string& relative) const;
+    std::shared_ptr<MappedSegment> openCommitted(const std::string& segment,
+                                                 const std::string& deletes) const;
+    static void writeDocuments(SegmentWriter& writer,
+                               const std::vector<const MappedSegment*>& segments,
+                               const InvertedIndex* memtable);
+    static void writePostings(SegmentWriter& writer,
+                              const std::vector<const MappedSegment*>& segments,
+                              const InvertedIndex* memtable);
+};
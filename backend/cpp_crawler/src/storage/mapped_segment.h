@@ -0,0 +1,465 @@
+#pragma once
+
+#include "block_cache.h"
+#include "posting_tier.h"
+#include "segment_format.h"
+#include "symbol_table.h"
+#include "../search/inverted_index.h"
+#include "../search/live_docs.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <zlib.h>
+
+// Read-only view of a segment file. The file is mapped with MAP_SHARED so
+// every process serving the same index shares one copy in the page cache;
+// postings, terms and documents are decoded straight from the mapping.
+// Stored content is the exception: its blocks are inflated on demand into
+// the shared BlockCache, so only documents that are actually shown cost a
+// decompression.
+class MappedSegment {
+public:
+    // Forward-only cursor over one term's postings
+    class PostingCursor {
+    public:
+        PostingCursor() = default;
+        PostingCursor(const uint8_t* data, size_t doc_freq)
+            : p_(data), remaining_(doc_freq), size_(doc_freq) {}
+
+        bool next() {
+            if (remaining_ == 0) return false;
+            if (positions_) {
+                for (size_t i = 0; i < freq_; ++i) {
+                    while (*p_++ & 0x80) {}
+                }
+            }
+            doc_ += SegmentFormat::readVarint(p_);
+            freq_ = SegmentFormat::readVarint(p_);
+            positions_ = p_;
+            remaining_--;
+            return true;
+        }
+
+        size_t docId() const { return doc_; }
+        size_t frequency() const { return freq_; }
+        size_t size() const { return size_; }
+
+        void positions(std::vector<size_t>& out) const {
+            out.clear();
+            const uint8_t* p = positions_;
+            size_t pos = 0;
+            for (size_t i = 0; i < freq_; ++i) {
+                pos += SegmentFormat::readVarint(p);
+                out.push_back(pos);
+            }
+        }
+
+    private:
+        const uint8_t* p_ = nullptr;
+        const uint8_t* positions_ = nullptr;
+        size_t remaining_ = 0;
+        size_t size_ = 0;
+        uint64_t doc_ = 0;
+        uint64_t freq_ = 0;
+    };
+
+    static std::shared_ptr<MappedSegment> open(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Cannot open segment: " + path);
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(SegmentFormat::SegmentHeader)) {
+            ::close(fd);
+            throw std::runtime_error("Truncated segment: " + path);
+        }
+
+        size_t size = static_cast<size_t>(st.st_size);
+        void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (data == MAP_FAILED) {
+            throw std::runtime_error("Cannot map segment: " + path);
+        }
+
+        return std::shared_ptr<MappedSegment>(new MappedSegment(path, data, size));
+    }
+
+    ~MappedSegment() {
+        BlockCache::shared().erase(cache_owner_);
+        munmap(data_, size_);
+    }
+
+    MappedSegment(const MappedSegment&) = delete;
+    MappedSegment& operator=(const MappedSegment&) = delete;
+
+    // Terms
+
+    size_t getTermCount() const { return header_->term_count; }
+
+    std::string_view termAt(size_t i) const {
+        const auto& entry = terms_[i];
+        return std::string_view(term_bytes_ + entry.term_offset, entry.term_length);
+    }
+
+    PostingCursor postingsAt(size_t i) const {
+        const auto& entry = terms_[i];
+        return PostingCursor(postings_ + entry.postings_offset, entry.doc_freq);
+    }
+
+    // Index of the term in the dictionary, or getTermCount() if absent
+    size_t findTerm(std::string_view term) const {
+        size_t lo = 0, hi = header_->term_count;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (termAt(mid) < term) lo = mid + 1;
+            else hi = mid;
+        }
+        return lo < header_->term_count && termAt(lo) == term ? lo : header_->term_count;
+    }
+
+    PostingCursor postings(std::string_view term) const {
+        size_t i = findTerm(term);
+        return i < header_->term_count ? postingsAt(i) : PostingCursor();
+    }
+
+    size_t getDocumentFrequency(std::string_view term) const {
+        size_t i = findTerm(term);
+        return i < header_->term_count ? terms_[i].doc_freq : 0;
+    }
+
+    // Calls f(doc_id, frequency) for every live posting of the term.
+    // With tiering enabled the access is counted and a hot copy of the
+    // list is read in place of the mapping when there is one.
+    template <typename F>
+    void forEachPosting(std::string_view term, F&& f) const {
+        size_t i = findTerm(term);
+        if (i >= header_->term_count) return;
+
+        PostingCursor cursor = postingsAt(i);
+        std::shared_ptr<const PostingTier::Generation> hot;
+        if (auto* tier = tier_.load(std::memory_order_acquire)) {
+            tier->recordAccess(i);
+            hot = tier->hotLists();
+            bool hit = false;
+            if (hot) {
+                auto it = hot->find(static_cast<uint32_t>(i));
+                if (it != hot->end()) {
+                    cursor = PostingCursor(it->second->data(), terms_[i].doc_freq);
+                    hit = true;
+                }
+            }
+            tier->recordLookup(hit);
+        }
+
+        while (cursor.next()) {
+            if (live_docs_.isLive(cursor.docId())) {
+                f(cursor.docId(), cursor.frequency());
+            }
+        }
+    }
+
+    // Documents
+
+    size_t getStoredDocumentCount() const { return header_->doc_count; }
+
+    size_t getDocumentCount() const {
+        return header_->doc_count - live_docs_.deletedCount();
+    }
+
+    size_t docIdAt(size_t i) const { return docs_[i].id; }
+    uint32_t normAt(size_t i) const { return norms_[i]; }
+
+    // Urls and titles are decoded per record when the segment codes them
+    // with a symbol table
+    std::string urlAt(size_t i) const {
+        const auto& e = docs_[i];
+        if (!coded_strings_) return std::string(doc_strings_ + e.url_offset, e.url_length);
+        return symbols_.decode(reinterpret_cast<const uint8_t*>(doc_strings_) + e.url_offset,
+                               e.title_offset - e.url_offset, e.url_length);
+    }
+
+    std::string titleAt(size_t i) const {
+        const auto& e = docs_[i];
+        if (!coded_strings_) return std::string(doc_strings_ + e.title_offset, e.title_length);
+        size_t end = i + 1 < header_->doc_count ? docs_[i + 1].url_offset : header_->doc_strings.size;
+        return symbols_.decode(reinterpret_cast<const uint8_t*>(doc_strings_) + e.title_offset,
+                               end - e.title_offset, e.title_length);
+    }
+
+    // Bytes the urls and titles occupy in the mapping
+    size_t docStringBytes() const { return header_->doc_strings.size; }
+
+    // Position in the doc table, or getStoredDocumentCount() if absent
+    size_t findDocument(size_t id) const {
+        const auto* begin = docs_;
+        const auto* end = docs_ + header_->doc_count;
+        const auto* it = std::lower_bound(begin, end, id,
+            [](const SegmentFormat::DocEntry& e, size_t value) { return e.id < value; });
+        return it != end && it->id == id ? static_cast<size_t>(it - begin) : header_->doc_count;
+    }
+
+    bool containsId(size_t id) const {
+        return header_->doc_count > 0 && id >= header_->min_doc_id && id <= header_->max_doc_id;
+    }
+
+    bool hasDocument(size_t id) const {
+        return containsId(id) && live_docs_.isLive(id) && findDocument(id) < header_->doc_count;
+    }
+
+    // Url and title only; tokens are not stored in the doc table
+    InvertedIndex::Document getDocument(size_t id) const {
+        size_t i = findDocument(id);
+        if (i >= header_->doc_count) {
+            throw std::out_of_range("Document not in segment");
+        }
+        return {id, urlAt(i), titleAt(i), {}, {}, norms_[i]};
+    }
+
+    // Like getDocument() plus the stored content, which may inflate a block
+    InvertedIndex::Document getStoredDocument(size_t id) const {
+        auto doc = getDocument(id);
+        doc.content = getContent(id);
+        return doc;
+    }
+
+    // Stored content of a document; empty if it has none
+    std::string getContent(size_t id) const {
+        const auto* begin = stored_index_;
+        const auto* end = stored_index_ + stored_block_count_;
+        const auto* it = std::upper_bound(begin, end, id,
+            [](size_t value, const SegmentFormat::StoredBlockEntry& e) { return value < e.first_doc_id; });
+        if (it == begin) return std::string();
+        --it;
+
+        auto block = BlockCache::shared().getOrLoad(cache_owner_, static_cast<uint64_t>(it - begin),
+            [&]() { return inflateBlock(*it); });
+
+        const uint8_t* p = reinterpret_cast<const uint8_t*>(block->data());
+        const uint8_t* block_end = p + block->size();
+        while (p < block_end) {
+            size_t doc = it->first_doc_id + SegmentFormat::readVarint(p);
+            size_t length = SegmentFormat::readVarint(p);
+            if (doc == id) {
+                return std::string(reinterpret_cast<const char*>(p), length);
+            }
+            if (doc > id) break;
+            p += length;
+        }
+        return std::string();
+    }
+
+    uint32_t getNorm(size_t id) const {
+        size_t i = findDocument(id);
+        return i < header_->doc_count ? norms_[i] : 0;
+    }
+
+    size_t getTotalTokens() const { return header_->total_tokens; }
+    size_t getMinDocId() const { return header_->min_doc_id; }
+    size_t getMaxDocId() const { return header_->max_doc_id; }
+
+    // Deletions
+
+    bool isLive(size_t id) const { return live_docs_.isLive(id); }
+
+    void removeDocument(size_t id) {
+        if (findDocument(id) < header_->doc_count) {
+            live_docs_.markDeleted(id);
+        }
+    }
+
+    const LiveDocs& getLiveDocs() const { return live_docs_; }
+
+    // Maps the same file again with a copy of the current tombstones, so a
+    // background reader gets a view that later deletes do not touch
+    std::shared_ptr<MappedSegment> snapshot() const {
+        auto copy = open(path_);
+        copy->live_docs_ = live_docs_;
+        return copy;
+    }
+
+    double getDeletedRatio() const {
+        return header_->doc_count == 0 ? 0.0
+            : static_cast<double>(live_docs_.deletedCount()) / header_->doc_count;
+    }
+
+    // Faults in the sections every query touches (dictionary, doc table,
+    // norms, doc strings) so the first queries after mapping do not stall
+    // on the disk. Postings are left to the queries. Returns bytes touched.
+    size_t prefault() const {
+        return prefault(std::chrono::steady_clock::time_point::max());
+    }
+
+    // As above, in chunks, stopping between them once the deadline has
+    // passed; *complete tells whether every section was touched
+    size_t prefault(std::chrono::steady_clock::time_point deadline, bool* complete = nullptr) const {
+        const SegmentFormat::Section* sections[] = {
+            &header_->dictionary, &header_->term_bytes, &header_->doc_table,
+            &header_->doc_strings, &header_->norms, &header_->stored_index,
+            &header_->symbol_table
+        };
+        size_t bytes = 0;
+        for (const auto* section : sections) {
+            if (section->size == 0) continue;
+            uintptr_t begin = reinterpret_cast<uintptr_t>(data_ + section->offset) & ~(pageSize() - 1);
+            uintptr_t end = reinterpret_cast<uintptr_t>(data_ + section->offset) + section->size;
+            for (uintptr_t at = begin; at < end; at += kPrefaultChunk) {
+                if (std::chrono::steady_clock::now() >= deadline) {
+                    if (complete) *complete = false;
+                    return bytes;
+                }
+                bytes += touch(reinterpret_cast<const uint8_t*>(at),
+                               std::min<uintptr_t>(kPrefaultChunk, end - at));
+            }
+        }
+        if (complete) *complete = true;
+        return bytes;
+    }
+
+    // Raw encoded postings of the term at index i
+    const uint8_t* postingsData(size_t i) const { return postings_ + terms_[i].postings_offset; }
+    size_t postingsSize(size_t i) const { return terms_[i].postings_size; }
+
+    // Starts counting term accesses for PostingTierManager; idempotent
+    PostingTier& enableTiering() const {
+        std::call_once(tier_once_, [this] {
+            tier_storage_ = std::make_unique<PostingTier>(header_->term_count);
+            tier_.store(tier_storage_.get(), std::memory_order_release);
+        });
+        return *tier_storage_;
+    }
+
+    PostingTier* tier() const { return tier_.load(std::memory_order_acquire); }
+
+    // Starts asynchronous read-ahead of a term's postings; returns the
+    // bytes advised
+    size_t adviseTerm(std::string_view term) const {
+        size_t i = findTerm(term);
+        if (i >= header_->term_count) return 0;
+        return advise(postings_ + terms_[i].postings_offset, terms_[i].postings_size);
+    }
+
+    // madvise(WILLNEED) over the pages spanning a range of the mapping
+    static size_t advise(const uint8_t* p, size_t size) {
+        if (size == 0) return 0;
+        uintptr_t start = reinterpret_cast<uintptr_t>(p) & ~(pageSize() - 1);
+        uintptr_t end = reinterpret_cast<uintptr_t>(p) + size;
+        ::madvise(reinterpret_cast<void*>(start), end - start, MADV_WILLNEED);
+        return end - start;
+    }
+
+    // Advises a range and then faults it in, one read per page
+    static size_t touch(const uint8_t* p, size_t size) {
+        size_t bytes = advise(p, size);
+        uintptr_t start = reinterpret_cast<uintptr_t>(p) & ~(pageSize() - 1);
+        uint8_t sum = 0;
+        for (uintptr_t at = start; at < start + bytes; at += pageSize()) {
+            sum += *reinterpret_cast<const volatile uint8_t*>(at);
+        }
+        (void)sum;
+        return bytes;
+    }
+
+    static size_t pageSize() {
+        static const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        return page;
+    }
+
+    const std::string& path() const { return path_; }
+    size_t fileSize() const { return size_; }
+    const uint8_t* data() const { return data_; }
+
+private:
+    // prefault() checks its deadline between chunks of this size
+    static constexpr size_t kPrefaultChunk = size_t(4) << 20;
+
+    std::string path_;
+    uint8_t* data_;
+    size_t size_;
+    const SegmentFormat::SegmentHeader* header_;
+    const uint8_t* postings_;
+    const SegmentFormat::TermEntry* terms_;
+    const char* term_bytes_;
+    const SegmentFormat::DocEntry* docs_;
+    const char* doc_strings_;
+    const uint32_t* norms_;
+    const uint8_t* stored_blocks_ = nullptr;
+    const SegmentFormat::StoredBlockEntry* stored_index_ = nullptr;
+    size_t stored_block_count_ = 0;
+    uint64_t cache_owner_ = BlockCache::newOwner();
+    SymbolTable symbols_;
+    bool coded_strings_ = false;
+    LiveDocs live_docs_;
+    mutable std::once_flag tier_once_;
+    mutable std::unique_ptr<PostingTier> tier_storage_;
+    mutable std::atomic<PostingTier*> tier_{nullptr};
+
+    MappedSegment(const std::string& path, void* data, size_t size)
+        : path_(path), data_(static_cast<uint8_t*>(data)), size_(size) {
+        header_ = reinterpret_cast<const SegmentFormat::SegmentHeader*>(data_);
+
+        if (header_->magic != SegmentFormat::kMagic || header_->version < SegmentFormat::kMinVersion ||
+            header_->version > SegmentFormat::kVersion || header_->file_size != size_) {
+            munmap(data_, size_);
+            throw std::runtime_error("Invalid segment header: " + path);
+        }
+
+        auto section = [&](const SegmentFormat::Section& s) {
+            if (s.offset + s.size > size_ || s.offset % SegmentFormat::kSectionAlignment != 0) {
+                munmap(data_, size_);
+                throw std::runtime_error("Corrupt segment section: " + path);
+            }
+            return data_ + s.offset;
+        };
+
+        postings_ = section(header_->postings);
+        terms_ = reinterpret_cast<const SegmentFormat::TermEntry*>(section(header_->dictionary));
+        term_bytes_ = reinterpret_cast<const char*>(section(header_->term_bytes));
+        docs_ = reinterpret_cast<const SegmentFormat::DocEntry*>(section(header_->doc_table));
+        doc_strings_ = reinterpret_cast<const char*>(section(header_->doc_strings));
+        norms_ = reinterpret_cast<const uint32_t*>(section(header_->norms));
+
+        if (header_->version >= 2) {
+            stored_blocks_ = section(header_->stored_blocks);
+            stored_index_ = reinterpret_cast<const SegmentFormat::StoredBlockEntry*>(
+                section(header_->stored_index));
+            stored_block_count_ = header_->stored_index.size / sizeof(SegmentFormat::StoredBlockEntry);
+        }
+        if (header_->version >= 3 && header_->symbol_table.size > 0) {
+            try {
+                symbols_ = SymbolTable::deserialize(section(header_->symbol_table),
+                                                    header_->symbol_table.size);
+            } catch (...) {
+                munmap(data_, size_);
+                throw;
+            }
+            coded_strings_ = true;
+        }
+    }
+
+    std::string inflateBlock(const SegmentFormat::StoredBlockEntry& entry) const {
+        if (entry.offset + entry.compressed_size > header_->stored_blocks.size) {
+            throw std::runtime_error("Corrupt stored block: " + path_);
+        }
+
+        std::string raw(entry.raw_size, '\0');
+        uLongf size = entry.raw_size;
+        if (uncompress(reinterpret_cast<Bytef*>(&raw[0]), &size,
+                       stored_blocks_ + entry.offset, entry.compressed_size) != Z_OK ||
+            size != entry.raw_size) {
+            throw std::runtime_error("Corrupt stored block: " + path_);
+        }
+        return raw;
+    }
+};
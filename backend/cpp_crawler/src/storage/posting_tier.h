@@ -0,0 +1,105 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <unordered_map>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// Access tracking and the RAM-resident copies of one segment's hot
+// posting lists. Queries bump a per-term counter and read a hot copy when
+// the current generation has one; PostingTierManager decides what is hot
+// and publishes a new generation. A query pins the generation it started
+// with, so a demoted list is freed only after the last reader is done.
+class PostingTier {
+public:
+    // Posting bytes copied out of the mapping into anonymous memory
+    class HotList {
+    public:
+        HotList(const uint8_t* source, size_t size, bool huge_pages) : size_(size) {
+            size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+            if (size < page) {
+                data_ = new uint8_t[size];
+            } else {
+                mapped_ = (size + page - 1) & ~(page - 1);
+                void* p = ::mmap(nullptr, mapped_, PROT_READ | PROT_WRITE,
+                                 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (p == MAP_FAILED) throw std::bad_alloc();
+#ifdef MADV_HUGEPAGE
+                if (huge_pages) ::madvise(p, mapped_, MADV_HUGEPAGE);
+#endif
+                data_ = static_cast<uint8_t*>(p);
+            }
+            std::memcpy(data_, source, size);
+        }
+
+        ~HotList() {
+            if (mapped_) {
+                ::munmap(data_, mapped_);
+            } else {
+                delete[] data_;
+            }
+        }
+
+        HotList(const HotList&) = delete;
+        HotList& operator=(const HotList&) = delete;
+
+        const uint8_t* data() const { return data_; }
+        size_t size() const { return size_; }
+
+    private:
+        uint8_t* data_ = nullptr;
+        size_t size_;
+        size_t mapped_ = 0;  // 0: heap allocation
+    };
+
+    // Hot lists by term index
+    using Generation = std::unordered_map<uint32_t, std::shared_ptr<const HotList>>;
+
+    explicit PostingTier(size_t term_count)
+        : counts_(new std::atomic<uint32_t>[term_count]()), term_count_(term_count) {}
+
+    size_t termCount() const { return term_count_; }
+
+    void recordAccess(size_t term) {
+        counts_[term].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    uint32_t accessCount(size_t term) const {
+        return counts_[term].load(std::memory_order_relaxed);
+    }
+
+    // Halves every counter so popularity fades unless renewed. Accesses
+    // racing with it may be lost, which only blurs the estimate.
+    void decay() {
+        for (size_t i = 0; i < term_count_; ++i) {
+            uint32_t count = counts_[i].load(std::memory_order_relaxed);
+            if (count) counts_[i].store(count >> 1, std::memory_order_relaxed);
+        }
+    }
+
+    std::shared_ptr<const Generation> hotLists() const {
+        return std::atomic_load(&generation_);
+    }
+
+    void publish(std::shared_ptr<const Generation> generation) {
+        std::atomic_store(&generation_, std::move(generation));
+    }
+
+    void recordLookup(bool hit) {
+        (hit ? hits_ : misses_).fetch_add(1, std::memory_order_relaxed);
+    }
+
+    uint64_t hits() const { return hits_.load(std::memory_order_relaxed); }
+    uint64_t misses() const { return misses_.load(std::memory_order_relaxed); }
+
+private:
+    std::unique_ptr<std::atomic<uint32_t>[]> counts_;
+    size_t term_count_;
+    std::shared_ptr<const Generation> generation_;
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+};
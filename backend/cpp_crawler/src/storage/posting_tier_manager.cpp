@@ -0,0 +1,140 @@
+#include "posting_tier_manager.h"
+#include <algorithm>
+
+PostingTierManager::PostingTierManager(SegmentSource source)
+    : PostingTierManager(std::move(source), Options()) {}
+
+PostingTierManager::PostingTierManager(SegmentSource source, const Options& options)
+    : source_(std::move(source)), options_(options) {}
+
+PostingTierManager::~PostingTierManager() {
+    stop();
+}
+
+void PostingTierManager::start() {
+    if (running_.exchange(true)) return;
+    for (const auto& segment : source_()) {
+        segment->enableTiering();
+    }
+    thread_ = std::thread(&PostingTierManager::threadLoop, this);
+}
+
+void PostingTierManager::stop() {
+    if (!running_.exchange(false)) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cv_.notify_all();
+    }
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void PostingTierManager::setMemoryBudget(size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    options_.memory_budget_bytes = bytes;
+}
+
+void PostingTierManager::threadLoop() {
+    while (running_) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait_for(lock, options_.interval, [this] { return !running_; });
+        }
+        if (!running_) break;
+        rebalance();
+    }
+}
+
+void PostingTierManager::rebalance() {
+    struct Candidate {
+        uint32_t segment;
+        uint32_t term;
+        uint32_t count;
+        bool hot;
+        size_t bytes;
+    };
+
+    auto segments = source_();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    size_t budget = options_.memory_budget_bytes;
+    bool huge_pages = options_.huge_pages;
+
+    std::vector<Candidate> candidates;
+    for (size_t s = 0; s < segments.size(); ++s) {
+        const auto& tier = segments[s]->enableTiering();
+        auto current = tier.hotLists();
+        for (size_t t = 0; t < tier.termCount(); ++t) {
+            uint32_t count = tier.accessCount(t);
+            if (count == 0) continue;
+            bool hot = current && current->count(static_cast<uint32_t>(t));
+            candidates.push_back({static_cast<uint32_t>(s), static_cast<uint32_t>(t), count, hot,
+                                  segments[s]->postingsSize(t)});
+        }
+    }
+
+    // Every byte of a list is read on each access, so the access count is
+    // also the disk traffic saved per byte kept resident. Ties keep what
+    // is already resident, so equally warm lists do not churn.
+    std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+        if (a.count != b.count) return a.count > b.count;
+        if (a.hot != b.hot) return a.hot;
+        return a.bytes < b.bytes;
+    });
+
+    std::vector<PostingTier::Generation> next(segments.size());
+    size_t used = 0;
+    for (const auto& candidate : candidates) {
+        if (candidate.bytes == 0 || used + candidate.bytes > budget) continue;
+        next[candidate.segment][candidate.term] = nullptr;
+        used += candidate.bytes;
+    }
+
+    size_t lists = 0;
+    for (size_t s = 0; s < segments.size(); ++s) {
+        const auto& segment = *segments[s];
+        auto& tier = segment.enableTiering();
+        auto current = tier.hotLists();
+
+        for (auto& [term, list] : next[s]) {
+            if (current) {
+                auto it = current->find(term);
+                if (it != current->end()) list = it->second;
+            }
+            if (!list) {
+                list = std::make_shared<const PostingTier::HotList>(
+                    segment.postingsData(term), segment.postingsSize(term), huge_pages);
+                promotions_++;
+            }
+        }
+        if (current) {
+            for (const auto& entry : *current) {
+                if (!next[s].count(entry.first)) demotions_++;
+            }
+        }
+
+        lists += next[s].size();
+        tier.publish(std::make_shared<const PostingTier::Generation>(std::move(next[s])));
+        tier.decay();
+    }
+
+    hot_lists_ = lists;
+    hot_bytes_ = used;
+    passes_++;
+}
+
+PostingTierManager::Stats PostingTierManager::getStats() const {
+    auto segments = source_();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    Stats stats{hot_lists_, hot_bytes_, options_.memory_budget_bytes,
+                promotions_, demotions_, passes_, 0, 0};
+    for (const auto& segment : segments) {
+        if (const auto* tier = segment->tier()) {
+            stats.hot_reads += tier->hits();
+            stats.cold_reads += tier->misses();
+        }
+    }
+    return stats;
+}
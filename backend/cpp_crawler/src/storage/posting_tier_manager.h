@@ -0,0 +1,72 @@
+#pragma once
+#include "mapped_segment.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Keeps the most frequently read posting lists of a set of segments in
+// RAM under one memory budget; everything else is read from the mapped
+// files. Each pass ranks lists by their decayed access counts, copies
+// newly hot ones out of the mapping, drops the ones that fell out of the
+// budget and halves the counters.
+class PostingTierManager {
+public:
+    // Returns the segments currently being served
+    using SegmentSource = std::function<std::vector<std::shared_ptr<MappedSegment>>()>;
+
+    struct Options {
+        size_t memory_budget_bytes = size_t(1) << 30;
+        std::chrono::milliseconds interval{10000};
+        bool huge_pages = false;  // madvise(MADV_HUGEPAGE) on large hot lists
+    };
+
+    struct Stats {
+        size_t hot_lists;
+        size_t hot_bytes;
+        size_t budget_bytes;
+        uint64_t promotions;
+        uint64_t demotions;
+        uint64_t passes;
+        uint64_t hot_reads;    // list reads served from RAM, current segments
+        uint64_t cold_reads;   // list reads served from the mapping
+    };
+
+    explicit PostingTierManager(SegmentSource source);
+    PostingTierManager(SegmentSource source, const Options& options);
+    ~PostingTierManager();
+
+    PostingTierManager(const PostingTierManager&) = delete;
+    PostingTierManager& operator=(const PostingTierManager&) = delete;
+
+    // Enables tracking on the current segments and rebalances every
+    // interval on a background thread
+    void start();
+    void stop();
+
+    // One promotion/demotion pass on the calling thread
+    void rebalance();
+
+    void setMemoryBudget(size_t bytes);
+    Stats getStats() const;
+
+private:
+    SegmentSource source_;
+    Options options_;
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+    mutable std::mutex mutex_;  // options_, stats and serializes passes
+    std::condition_variable cv_;
+
+    size_t hot_lists_ = 0;
+    size_t hot_bytes_ = 0;
+    uint64_t promotions_ = 0;
+    uint64_t demotions_ = 0;
+    uint64_t passes_ = 0;
+
+    void threadLoop();
+};
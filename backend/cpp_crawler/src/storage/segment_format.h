@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+// On-disk segment layout. Every section starts on a kSectionAlignment
+// boundary so it can be read in place from a read-only mapping:
+//
+//   SegmentHeader
+//   stored blocks zlib-compressed blocks of stored document content
+//   postings      per term: varint(doc gap) varint(freq) freq x varint(pos gap)
+//   dictionary    TermEntry[term_count], sorted by term bytes
+//   term bytes
+//   doc table     DocEntry[doc_count], sorted by id
+//   doc strings   url and title bytes, symbol-table coded if present
+//   norms         uint32_t[doc_count], token count per document
+//   stored index  StoredBlockEntry[block_count], sorted by first doc id
+//   symbol table  SymbolTable::serialize() output; empty for plain strings
+//
+// A stored block decompresses to per document: varint(id - first doc id)
+// varint(length) content bytes. Version 1 segments have no stored content.
+//
+// With a symbol table, DocEntry offsets address the coded bytes and the
+// lengths are the decoded lengths; each url and title is coded on its own
+// and a document's title runs up to the next document's url.
+//
+// Integers are stored little-endian (the only byte order we deploy on).
+struct SegmentFormat {
+    static constexpr uint32_t kMagic = 0x4745535a;   // "ZSEG"
+    static constexpr uint32_t kVersion = 3;
+    static constexpr uint32_t kMinVersion = 1;
+    static constexpr size_t kSectionAlignment = 64;
+
+    struct Section {
+        uint64_t offset;
+        uint64_t size;
+    };
+
+    struct SegmentHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t doc_count;
+        uint64_t term_count;
+        uint64_t total_tokens;
+        uint64_t min_doc_id;
+        uint64_t max_doc_id;
+        Section postings;
+        Section dictionary;
+        Section term_bytes;
+        Section doc_table;
+        Section doc_strings;
+        Section norms;
+        uint64_t file_size;
+        Section stored_blocks;
+        Section stored_index;
+        Section symbol_table;
+    };
+
+    struct TermEntry {
+        uint64_t term_offset;
+        uint32_t term_length;
+        uint32_t doc_freq;
+        uint64_t postings_offset;
+        uint64_t postings_size;
+    };
+
+    struct DocEntry {
+        uint64_t id;
+        uint64_t url_offset;
+        uint64_t title_offset;
+        uint32_t url_length;
+        uint32_t title_length;
+    };
+
+    struct StoredBlockEntry {
+        uint64_t first_doc_id;
+        uint64_t offset;           // relative to the stored blocks section
+        uint32_t compressed_size;
+        uint32_t raw_size;
+    };
+
+    static size_t alignUp(size_t value) {
+        return (value + kSectionAlignment - 1) & ~(kSectionAlignment - 1);
+    }
+
+    static void writeVarint(std::string& out, uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<char>((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<char>(value));
+    }
+
+    static uint64_t readVarint(const uint8_t*& p) {
+        uint64_t value = *p & 0x7f;
+        int shift = 7;
+        while (*p++ & 0x80) {
+            value |= static_cast<uint64_t>(*p & 0x7f) << shift;
+            shift += 7;
+        }
+        return value;
+    }
+};
+
+static_assert(std::is_trivially_copyable<SegmentFormat::SegmentHeader>::value, "header must be POD");
+static_assert(sizeof(SegmentFormat::TermEntry) == 32, "TermEntry layout changed");
+static_assert(sizeof(SegmentFormat::DocEntry) == 32, "DocEntry layout changed");
+static_assert(sizeof(SegmentFormat::StoredBlockEntry) == 24, "StoredBlockEntry layout changed");
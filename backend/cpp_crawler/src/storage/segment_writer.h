@@ -0,0 +1,324 @@
+#pragma once
+
+#include "segment_format.h"
+#include "symbol_table.h"
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include <zlib.h>
+
+// Streams a segment file in the layout described in segment_format.h.
+// Stored content is compressed into blocks as documents arrive and
+// postings are written as terms arrive; the dictionary and doc table are
+// buffered and appended by finish(). The file is written under a temporary
+// name and renamed into place, so readers never see a partial segment.
+class SegmentWriter {
+public:
+    explicit SegmentWriter(const std::string& path)
+        : path_(path), tmp_path_(path + ".tmp") {
+        fd_ = ::open(tmp_path_.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd_ < 0) {
+            throw std::runtime_error("Cannot create segment: " + tmp_path_ + ": " + std::strerror(errno));
+        }
+        offset_ = SegmentFormat::alignUp(sizeof(SegmentFormat::SegmentHeader));
+        header_.stored_blocks.offset = offset_;
+        if (::ftruncate(fd_, offset_) != 0 || ::lseek(fd_, offset_, SEEK_SET) < 0) {
+            fail("Cannot reserve segment header");
+        }
+    }
+
+    ~SegmentWriter() {
+        if (fd_ >= 0) {
+            ::close(fd_);
+            ::unlink(tmp_path_.c_str());
+        }
+    }
+
+    SegmentWriter(const SegmentWriter&) = delete;
+    SegmentWriter& operator=(const SegmentWriter&) = delete;
+
+    // Documents must arrive in ascending id order and before any term
+    void addDocument(size_t id, const std::string& url, const std::string& title, uint32_t length,
+                     std::string_view content = {}) {
+        if (!docs_.empty() && id <= docs_.back().id) {
+            throw std::logic_error("Segment documents must be added in ascending id order");
+        }
+        if (postings_started_) {
+            throw std::logic_error("Segment documents must be added before terms");
+        }
+
+        SegmentFormat::DocEntry entry{};
+        entry.id = id;
+        entry.url_offset = doc_strings_.size();
+        entry.url_length = static_cast<uint32_t>(url.size());
+        doc_strings_ += url;
+        entry.title_offset = doc_strings_.size();
+        entry.title_length = static_cast<uint32_t>(title.size());
+        doc_strings_ += title;
+
+        docs_.push_back(entry);
+        norms_.push_back(length);
+        header_.total_tokens += length;
+
+        if (!content.empty()) {
+            if (stored_raw_.empty()) stored_first_id_ = id;
+            SegmentFormat::writeVarint(stored_raw_, id - stored_first_id_);
+            SegmentFormat::writeVarint(stored_raw_, content.size());
+            stored_raw_.append(content.data(), content.size());
+            if (stored_raw_.size() >= kStoredBlockBytes) {
+                flushStoredBlock();
+            }
+        }
+    }
+
+    // Terms must arrive in ascending byte order, postings in ascending doc id
+    void startTerm(const std::string& term) {
+        if (!terms_.empty() && term <= last_term_) {
+            throw std::logic_error("Segment terms must be added in ascending order");
+        }
+        if (!postings_started_) {
+            beginPostings();
+        }
+
+        SegmentFormat::TermEntry entry{};
+        entry.term_offset = term_bytes_.size();
+        entry.term_length = static_cast<uint32_t>(term.size());
+        entry.postings_offset = offset_ + buffer_.size() - header_.postings.offset;
+        terms_.push_back(entry);
+
+        term_bytes_ += term;
+        last_term_ = term;
+        last_doc_ = 0;
+    }
+
+    template <typename Positions>
+    void addPosting(size_t doc_id, size_t frequency, const Positions& positions) {
+        auto& entry = terms_.back();
+        if (entry.doc_freq > 0 && doc_id <= last_doc_) {
+            throw std::logic_error("Segment postings must be added in ascending doc order");
+        }
+
+        SegmentFormat::writeVarint(buffer_, doc_id - last_doc_);
+        SegmentFormat::writeVarint(buffer_, frequency);
+        size_t prev = 0;
+        for (auto pos : positions) {
+            SegmentFormat::writeVarint(buffer_, pos - prev);
+            prev = pos;
+        }
+
+        entry.doc_freq++;
+        last_doc_ = doc_id;
+
+        if (buffer_.size() >= kFlushBytes) {
+            flushBuffer();
+        }
+    }
+
+    void finishTerm() {
+        auto& entry = terms_.back();
+        entry.postings_size = offset_ + buffer_.size() - header_.postings.offset - entry.postings_offset;
+        // Drop terms whose postings were all filtered out by the caller
+        if (entry.doc_freq == 0) {
+            term_bytes_.resize(entry.term_offset);
+            terms_.pop_back();
+        }
+    }
+
+    void finish() {
+        if (!postings_started_) {
+            beginPostings();
+        }
+        flushBuffer();
+        header_.postings.size = offset_ - header_.postings.offset;
+
+        header_.dictionary = writeSection(terms_.data(), terms_.size() * sizeof(SegmentFormat::TermEntry));
+        header_.term_bytes = writeSection(term_bytes_.data(), term_bytes_.size());
+        std::string symbols = compressDocStrings();
+        header_.doc_table = writeSection(docs_.data(), docs_.size() * sizeof(SegmentFormat::DocEntry));
+        header_.doc_strings = writeSection(doc_strings_.data(), doc_strings_.size());
+        header_.norms = writeSection(norms_.data(), norms_.size() * sizeof(uint32_t));
+        header_.stored_index = writeSection(stored_index_.data(),
+            stored_index_.size() * sizeof(SegmentFormat::StoredBlockEntry));
+        header_.symbol_table = writeSection(symbols.data(), symbols.size());
+
+        header_.magic = SegmentFormat::kMagic;
+        header_.version = SegmentFormat::kVersion;
+        header_.doc_count = docs_.size();
+        header_.term_count = terms_.size();
+        header_.min_doc_id = docs_.empty() ? 0 : docs_.front().id;
+        header_.max_doc_id = docs_.empty() ? 0 : docs_.back().id;
+        header_.file_size = offset_;
+
+        char raw[sizeof(header_)];
+        std::memcpy(raw, &header_, sizeof(raw));
+        if (::pwrite(fd_, raw, sizeof(raw), 0) != static_cast<ssize_t>(sizeof(raw))) {
+            fail("Cannot write segment header");
+        }
+        if (::fsync(fd_) != 0) {
+            fail("Cannot sync segment");
+        }
+        ::close(fd_);
+        fd_ = -1;
+
+        if (std::rename(tmp_path_.c_str(), path_.c_str()) != 0) {
+            ::unlink(tmp_path_.c_str());
+            throw std::runtime_error("Cannot rename segment into place: " + path_);
+        }
+    }
+
+    // Called with the size of every write before it is issued; background
+    // writers use it to pace themselves
+    void setWriteHook(std::function<void(size_t)> hook) {
+        write_hook_ = std::move(hook);
+    }
+
+    size_t documentCount() const { return docs_.size(); }
+    size_t termCount() const { return terms_.size(); }
+    size_t bytesWritten() const { return offset_ + buffer_.size(); }
+
+private:
+    static constexpr size_t kFlushBytes = 1 << 20;
+    static constexpr size_t kStoredBlockBytes = 32 << 10;
+    static constexpr size_t kSymbolSampleBytes = 64 << 10;
+
+    std::string path_;
+    std::string tmp_path_;
+    int fd_ = -1;
+    size_t offset_ = 0;
+    std::string buffer_;
+
+    SegmentFormat::SegmentHeader header_{};
+    std::vector<SegmentFormat::TermEntry> terms_;
+    std::string term_bytes_;
+    std::string last_term_;
+    size_t last_doc_ = 0;
+    std::vector<SegmentFormat::DocEntry> docs_;
+    std::string doc_strings_;
+    std::vector<uint32_t> norms_;
+    std::string stored_raw_;
+    std::string stored_compressed_;
+    size_t stored_first_id_ = 0;
+    std::vector<SegmentFormat::StoredBlockEntry> stored_index_;
+    bool postings_started_ = false;
+    std::function<void(size_t)> write_hook_;
+
+    void flushStoredBlock() {
+        if (stored_raw_.empty()) return;
+
+        uLongf size = compressBound(stored_raw_.size());
+        stored_compressed_.resize(size);
+        if (compress2(reinterpret_cast<Bytef*>(&stored_compressed_[0]), &size,
+                      reinterpret_cast<const Bytef*>(stored_raw_.data()), stored_raw_.size(),
+                      Z_DEFAULT_COMPRESSION) != Z_OK) {
+            fail("Cannot compress stored block");
+        }
+
+        SegmentFormat::StoredBlockEntry entry{};
+        entry.first_doc_id = stored_first_id_;
+        entry.offset = offset_ - header_.stored_blocks.offset;
+        entry.compressed_size = static_cast<uint32_t>(size);
+        entry.raw_size = static_cast<uint32_t>(stored_raw_.size());
+        stored_index_.push_back(entry);
+
+        writeAll(stored_compressed_.data(), size);
+        stored_raw_.clear();
+    }
+
+    // Codes every url and title with a symbol table trained on an evenly
+    // spread sample of them. Returns the serialized table, or nothing if
+    // coding would not make the strings smaller.
+    std::string compressDocStrings() {
+        if (docs_.empty()) return std::string();
+
+        auto url = [this](const SegmentFormat::DocEntry& e) {
+            return std::string_view(doc_strings_.data() + e.url_offset, e.url_length);
+        };
+        auto title = [this](const SegmentFormat::DocEntry& e) {
+            return std::string_view(doc_strings_.data() + e.title_offset, e.title_length);
+        };
+
+        std::vector<std::string_view> sample;
+        size_t stride = std::max<size_t>(1, doc_strings_.size() / kSymbolSampleBytes);
+        for (size_t i = 0; i < docs_.size(); i += stride) {
+            sample.push_back(url(docs_[i]));
+            sample.push_back(title(docs_[i]));
+        }
+        SymbolTable table = SymbolTable::train(sample);
+
+        std::string coded;
+        coded.reserve(doc_strings_.size() / 2);
+        std::vector<SegmentFormat::DocEntry> entries = docs_;
+        for (auto& entry : entries) {
+            std::string_view u = url(entry), t = title(entry);
+            entry.url_offset = coded.size();
+            table.encode(u, coded);
+            entry.title_offset = coded.size();
+            table.encode(t, coded);
+        }
+
+        std::string serialized = table.serialize();
+        if (coded.size() + serialized.size() >= doc_strings_.size()) {
+            return std::string();
+        }
+        docs_ = std::move(entries);
+        doc_strings_ = std::move(coded);
+        return serialized;
+    }
+
+    // Seals the stored blocks; postings start on the next aligned offset
+    void beginPostings() {
+        flushStoredBlock();
+        header_.stored_blocks.size = offset_ - header_.stored_blocks.offset;
+        static const char zeros[SegmentFormat::kSectionAlignment] = {};
+        writeAll(zeros, SegmentFormat::alignUp(offset_) - offset_);
+        header_.postings.offset = offset_;
+        postings_started_ = true;
+    }
+
+    void flushBuffer() {
+        writeAll(buffer_.data(), buffer_.size());
+        buffer_.clear();
+    }
+
+    SegmentFormat::Section writeSection(const void* data, size_t size) {
+        size_t aligned = SegmentFormat::alignUp(offset_);
+        static const char zeros[SegmentFormat::kSectionAlignment] = {};
+        writeAll(zeros, aligned - offset_);
+
+        SegmentFormat::Section section{offset_, size};
+        writeAll(data, size);
+        return section;
+    }
+
+    void writeAll(const void* data, size_t size) {
+        if (write_hook_ && size > 0) {
+            write_hook_(size);
+        }
+        const char* p = static_cast<const char*>(data);
+        while (size > 0) {
+            ssize_t n = ::write(fd_, p, size);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                fail("Cannot write segment");
+            }
+            p += n;
+            size -= static_cast<size_t>(n);
+            offset_ += static_cast<size_t>(n);
+        }
+    }
+
+    [[noreturn]] void fail(const std::string& message) {
+        std::string error = message + ": " + tmp_path_ + ": " + std::strerror(errno);
+        ::close(fd_);
+        ::unlink(tmp_path_.c_str());
+        fd_ = -1;
+        throw std::runtime_error(error);
+    }
+};
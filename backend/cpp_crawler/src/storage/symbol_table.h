@@ -0,0 +1,195 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Static symbol-table string compression in the style of FSST: up to 255
+// symbols of 1-8 bytes each map to one-byte codes, and code 255 escapes a
+// literal byte. The table is trained once per segment on a sample of its
+// strings; afterwards each string is encoded on its own, so any record
+// can be decoded without touching its neighbours. Decoding is a table
+// lookup and one unaligned 8-byte copy per code.
+class SymbolTable {
+public:
+    static constexpr uint8_t kEscape = 255;
+    static constexpr size_t kMaxSymbols = 255;
+    static constexpr size_t kMaxSymbolLength = 8;
+
+    SymbolTable() { rebuildIndex(); }
+
+    // FSST's bottom-up construction: encode the sample with the current
+    // table, count every emitted symbol and every adjacent pair that still
+    // fits in 8 bytes, keep the 255 with the highest byte gain, repeat.
+    static SymbolTable train(const std::vector<std::string_view>& sample) {
+        SymbolTable table;
+        std::unordered_map<std::string, size_t> counts;
+        std::vector<std::string> emitted;
+
+        for (int round = 0; round < kTrainingRounds; ++round) {
+            counts.clear();
+            for (auto text : sample) {
+                emitted.clear();
+                table.split(text, emitted);
+                for (size_t i = 0; i < emitted.size(); ++i) {
+                    counts[emitted[i]]++;
+                    if (i + 1 < emitted.size() &&
+                        emitted[i].size() + emitted[i + 1].size() <= kMaxSymbolLength) {
+                        counts[emitted[i] + emitted[i + 1]]++;
+                    }
+                }
+            }
+
+            std::vector<std::pair<size_t, const std::string*>> ranked;
+            ranked.reserve(counts.size());
+            for (const auto& [symbol, count] : counts) {
+                ranked.push_back({count * symbol.size(), &symbol});
+            }
+            size_t keep = std::min(kMaxSymbols, ranked.size());
+            std::partial_sort(ranked.begin(), ranked.begin() + keep, ranked.end(),
+                [](const auto& a, const auto& b) {
+                    return a.first != b.first ? a.first > b.first : *a.second < *b.second;
+                });
+
+            SymbolTable next;
+            for (size_t i = 0; i < keep; ++i) {
+                next.addSymbol(*ranked[i].second);
+            }
+            next.rebuildIndex();
+            table = std::move(next);
+        }
+        return table;
+    }
+
+    size_t size() const { return lengths_.size(); }
+
+    // Appends the codes for text to out
+    void encode(std::string_view text, std::string& out) const {
+        size_t i = 0;
+        while (i < text.size()) {
+            int code = longestMatch(text, i);
+            if (code < 0) {
+                out.push_back(static_cast<char>(kEscape));
+                out.push_back(text[i++]);
+            } else {
+                out.push_back(static_cast<char>(code));
+                i += lengths_[code];
+            }
+        }
+    }
+
+    // Decodes into out, which must have room for the decoded length plus
+    // kMaxSymbolLength bytes of slack. Returns the decoded length.
+    size_t decode(const uint8_t* in, size_t in_size, char* out, size_t capacity) const {
+        const uint8_t* end = in + in_size;
+        char* o = out;
+        char* limit = out + capacity - kMaxSymbolLength;
+        while (in < end && o <= limit) {
+            uint8_t code = *in++;
+            if (code == kEscape) {
+                if (in == end) break;
+                *o++ = static_cast<char>(*in++);
+            } else {
+                std::memcpy(o, &symbols_[code], kMaxSymbolLength);
+                o += lengths_[code];
+            }
+        }
+        return static_cast<size_t>(o - out);
+    }
+
+    std::string decode(const uint8_t* in, size_t in_size, size_t decoded_size) const {
+        // Short strings go through the stack so the slack never forces a
+        // heap allocation the result itself would not need
+        if (decoded_size <= kStackDecodeBytes) {
+            char buffer[kStackDecodeBytes + kMaxSymbolLength];
+            return std::string(buffer, decode(in, in_size, buffer, sizeof(buffer)));
+        }
+        std::string out(decoded_size + kMaxSymbolLength, '\0');
+        out.resize(decode(in, in_size, &out[0], out.size()));
+        return out;
+    }
+
+    // [uint8 count] then per symbol [uint8 length][length bytes]
+    std::string serialize() const {
+        std::string out;
+        out.push_back(static_cast<char>(lengths_.size()));
+        for (size_t i = 0; i < lengths_.size(); ++i) {
+            out.push_back(static_cast<char>(lengths_[i]));
+            out.append(reinterpret_cast<const char*>(&symbols_[i]), lengths_[i]);
+        }
+        return out;
+    }
+
+    static SymbolTable deserialize(const uint8_t* data, size_t size) {
+        SymbolTable table;
+        if (size == 0) return table;
+
+        const uint8_t* end = data + size;
+        size_t count = *data++;
+        for (size_t i = 0; i < count; ++i) {
+            if (data >= end || *data == 0 || *data > kMaxSymbolLength || end - data - 1 < *data) {
+                throw std::runtime_error("Corrupt symbol table");
+            }
+            size_t length = *data++;
+            table.addSymbol(std::string_view(reinterpret_cast<const char*>(data), length));
+            data += length;
+        }
+        table.rebuildIndex();
+        return table;
+    }
+
+private:
+    static constexpr int kTrainingRounds = 5;
+    static constexpr size_t kStackDecodeBytes = 256;
+
+    std::vector<uint64_t> symbols_;   // zero-padded to 8 bytes
+    std::vector<uint8_t> lengths_;
+    // Codes grouped by first byte, longest symbol first
+    std::vector<uint8_t> by_first_[256];
+
+    void addSymbol(std::string_view symbol) {
+        uint64_t word = 0;
+        std::memcpy(&word, symbol.data(), symbol.size());
+        symbols_.push_back(word);
+        lengths_.push_back(static_cast<uint8_t>(symbol.size()));
+    }
+
+    void rebuildIndex() {
+        for (auto& codes : by_first_) codes.clear();
+        for (size_t code = 0; code < lengths_.size(); ++code) {
+            uint8_t first = static_cast<uint8_t>(symbols_[code] & 0xff);
+            by_first_[first].push_back(static_cast<uint8_t>(code));
+        }
+        for (auto& codes : by_first_) {
+            std::stable_sort(codes.begin(), codes.end(),
+                [this](uint8_t a, uint8_t b) { return lengths_[a] > lengths_[b]; });
+        }
+    }
+
+    int longestMatch(std::string_view text, size_t at) const {
+        size_t remaining = text.size() - at;
+        for (uint8_t code : by_first_[static_cast<uint8_t>(text[at])]) {
+            size_t length = lengths_[code];
+            if (length <= remaining && std::memcmp(&symbols_[code], text.data() + at, length) == 0) {
+                return code;
+            }
+        }
+        return -1;
+    }
+
+    // Splits text the way encode() would, escapes as single bytes
+    void split(std::string_view text, std::vector<std::string>& out) const {
+        size_t i = 0;
+        while (i < text.size()) {
+            int code = longestMatch(text, i);
+            size_t length = code < 0 ? 1 : lengths_[code];
+            out.emplace_back(text.substr(i, length));
+            i += length;
+        }
+    }
+};
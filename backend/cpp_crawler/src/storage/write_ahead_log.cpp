@@ -0,0 +1,273 @@
+#include "write_ahead_log.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+#include <zlib.h>
+
+namespace {
+
+constexpr size_t kFrameHeader = 8;
+constexpr uint32_t kMaxRecordBytes = 64u << 20;
+
+uint32_t checksum(const char* data, size_t size) {
+    return static_cast<uint32_t>(crc32(0L, reinterpret_cast<const Bytef*>(data), static_cast<uInt>(size)));
+}
+
+void putU32(std::string& out, uint32_t value) {
+    char bytes[4];
+    std::memcpy(bytes, &value, 4);
+    out.append(bytes, 4);
+}
+
+uint32_t getU32(const char* p) {
+    uint32_t value;
+    std::memcpy(&value, p, 4);
+    return value;
+}
+
+// Makes a file created in the directory durable; fdatasync on the file
+// alone leaves its directory entry to chance
+void syncDirectory(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open WAL directory: " + path + ": " + std::strerror(errno));
+    }
+    int result = ::fsync(fd);
+    int error = errno;
+    ::close(fd);
+    if (result != 0) {
+        throw std::runtime_error("WAL directory sync failed: " + path + ": " + std::strerror(error));
+    }
+}
+
+} // namespace
+
+WriteAheadLog::WriteAheadLog(const std::string& dir,
+                             size_t group_commit_bytes,
+                             std::chrono::milliseconds group_commit_delay)
+    : dir_(dir),
+      group_commit_bytes_(group_commit_bytes),
+      group_commit_delay_(group_commit_delay) {}
+
+WriteAheadLog::~WriteAheadLog() {
+    close();
+}
+
+std::string WriteAheadLog::filePath(uint64_t number) const {
+    char name[32];
+    std::snprintf(name, sizeof(name), "wal-%016llu.log", static_cast<unsigned long long>(number));
+    return (std::filesystem::path(dir_) / name).string();
+}
+
+std::vector<std::pair<uint64_t, std::string>> WriteAheadLog::listFiles() const {
+    std::vector<std::pair<uint64_t, std::string>> files;
+    if (!std::filesystem::exists(dir_)) return files;
+
+    for (const auto& entry : std::filesystem::directory_iterator(dir_)) {
+        std::string name = entry.path().filename().string();
+        unsigned long long number;
+        if (std::sscanf(name.c_str(), "wal-%llu.log", &number) == 1) {
+            files.push_back({number, entry.path().string()});
+        }
+    }
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+size_t WriteAheadLog::replay(const std::function<void(const std::string&)>& f) const {
+    size_t records = 0;
+    std::string payload;
+
+    for (const auto& [number, path] : listFiles()) {
+        std::ifstream in(path, std::ios::binary);
+        char header[kFrameHeader];
+
+        while (in.read(header, kFrameHeader)) {
+            uint32_t length = getU32(header);
+            uint32_t crc = getU32(header + 4);
+            if (length > kMaxRecordBytes) break;
+
+            payload.resize(length);
+            if (!in.read(&payload[0], length) || checksum(payload.data(), length) != crc) {
+                break;  // torn write at the tail of the file
+            }
+            f(payload);
+            records++;
+        }
+    }
+    return records;
+}
+
+void WriteAheadLog::open() {
+    if (std::filesystem::create_directories(dir_)) {
+        auto path = std::filesystem::absolute(dir_);
+        if (!path.has_filename()) path = path.parent_path();
+        syncDirectory(path.parent_path().string());
+    }
+
+    auto files = listFiles();
+    openFile(files.empty() ? 1 : files.back().first + 1);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    running_ = true;
+    flusher_ = std::thread(&WriteAheadLog::flusherLoop, this);
+}
+
+void WriteAheadLog::close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) return;
+        running_ = false;
+    }
+    flush_cv_.notify_all();
+    flusher_.join();
+
+    syncPending();
+    std::lock_guard<std::mutex> lock(file_mutex_);
+    ::close(fd_);
+    fd_ = -1;
+}
+
+// Called before records can be written to the file: by open(), and by
+// rotate() with file_mutex_ held, so no batch is synced to the new file
+// until its directory entry is durable
+void WriteAheadLog::openFile(uint64_t number) {
+    int fd = ::open(filePath(number).c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open WAL file: " + filePath(number) + ": " + std::strerror(errno));
+    }
+    try {
+        syncDirectory(dir_);
+    } catch (...) {
+        ::close(fd);
+        throw;
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+    fd_ = fd;
+    file_number_ = number;
+}
+
+uint64_t WriteAheadLog::append(const std::string& payload) {
+    std::string frame;
+    frame.reserve(kFrameHeader + payload.size());
+    putU32(frame, static_cast<uint32_t>(payload.size()));
+    putU32(frame, checksum(payload.data(), payload.size()));
+    frame += payload;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!running_) {
+        return 0;
+    }
+    bool first = pending_.empty();
+    if (first) {
+        oldest_pending_ = std::chrono::steady_clock::now();
+    }
+    pending_ += frame;
+
+    // Wake the flusher to arm the delay timer, or to sync a full batch
+    if (first || pending_.size() >= group_commit_bytes_) {
+        flush_cv_.notify_one();
+    }
+    return next_lsn_++;
+}
+
+void WriteAheadLog::waitDurable(uint64_t lsn) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    // close() syncs everything appended before it returns, so a stopped
+    // log is no reason to give up early; an lsn never handed out is
+    durable_cv_.wait(lock, [&] { return durable_lsn_ >= lsn || lsn >= next_lsn_; });
+}
+
+uint64_t WriteAheadLog::durableLsn() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return durable_lsn_;
+}
+
+size_t WriteAheadLog::syncCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return sync_count_;
+}
+
+void WriteAheadLog::flusherLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (running_) {
+        if (pending_.empty()) {
+            flush_cv_.wait(lock);
+            continue;
+        }
+
+        auto deadline = oldest_pending_ + group_commit_delay_;
+        flush_cv_.wait_until(lock, deadline, [&] {
+            return !running_ || pending_.size() >= group_commit_bytes_;
+        });
+        if (!running_) break;
+
+        lock.unlock();
+        syncPending();
+        lock.lock();
+    }
+}
+
+void WriteAheadLog::syncPending() {
+    std::lock_guard<std::mutex> file_lock(file_mutex_);
+    syncPendingLocked();
+}
+
+// Caller holds file_mutex_. A failed write or sync throws: on the flusher
+// thread that terminates the process, which is the only safe outcome once
+// durability can no longer be promised.
+void WriteAheadLog::syncPendingLocked() {
+    std::string batch;
+    uint64_t batch_lsn;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        batch.swap(pending_);
+        batch_lsn = next_lsn_ - 1;
+    }
+    if (batch.empty()) return;
+
+    const char* p = batch.data();
+    size_t remaining = batch.size();
+    while (remaining > 0) {
+        ssize_t n = ::write(fd_, p, remaining);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            throw std::runtime_error(std::string("WAL write failed: ") + std::strerror(errno));
+        }
+        p += n;
+        remaining -= static_cast<size_t>(n);
+    }
+    if (::fdatasync(fd_) != 0) {
+        throw std::runtime_error(std::string("WAL sync failed: ") + std::strerror(errno));
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        durable_lsn_ = batch_lsn;
+        sync_count_++;
+    }
+    durable_cv_.notify_all();
+}
+
+uint64_t WriteAheadLog::rotate() {
+    std::lock_guard<std::mutex> file_lock(file_mutex_);
+    syncPendingLocked();
+    openFile(file_number_ + 1);
+    return file_number_;
+}
+
+void WriteAheadLog::dropFilesBefore(uint64_t file_number) {
+    for (const auto& [number, path] : listFiles()) {
+        if (number < file_number) {
+            std::filesystem::remove(path);
+        }
+    }
+}
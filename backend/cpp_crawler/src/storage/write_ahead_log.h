@@ -0,0 +1,76 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Append-only, checksummed log with group commit.
+//
+// Records are framed as [uint32 length][uint32 crc32][payload] and
+// buffered in memory; a flusher thread writes and fdatasyncs the buffer
+// once it reaches group_commit_bytes or its oldest record is
+// group_commit_delay old, so one sync covers many appends.
+//
+// The log is a directory of numbered files. open() starts a fresh file;
+// rotate() seals the current one so it can be dropped after a checkpoint.
+// The directory is synced after each file is created, before any record
+// in it is reported durable.
+class WriteAheadLog {
+public:
+    WriteAheadLog(const std::string& dir,
+                  size_t group_commit_bytes = 1 << 20,
+                  std::chrono::milliseconds group_commit_delay = std::chrono::milliseconds(5));
+    ~WriteAheadLog();
+
+    // Calls f(payload) for every intact record of every existing file, in
+    // order. Replay stops at the first torn or corrupt record of a file.
+    size_t replay(const std::function<void(const std::string&)>& f) const;
+
+    void open();
+    void close();
+
+    // Returns the record's sequence number; durable once durableLsn() >= it.
+    // A log that is not open refuses the record and returns 0.
+    uint64_t append(const std::string& payload);
+    void waitDurable(uint64_t lsn);
+    uint64_t durableLsn() const;
+
+    // Seals the current file and starts a new one. Returns the number of
+    // the new file; files below it hold only records appended before.
+    // Callers must not append concurrently with rotate().
+    uint64_t rotate();
+    void dropFilesBefore(uint64_t file_number);
+
+    size_t syncCount() const;
+
+private:
+    std::string dir_;
+    size_t group_commit_bytes_;
+    std::chrono::milliseconds group_commit_delay_;
+
+    int fd_ = -1;
+    uint64_t file_number_ = 0;
+    std::mutex file_mutex_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable flush_cv_;
+    std::condition_variable durable_cv_;
+    std::string pending_;
+    std::chrono::steady_clock::time_point oldest_pending_;
+    uint64_t next_lsn_ = 1;
+    uint64_t durable_lsn_ = 0;
+    size_t sync_count_ = 0;
+    bool running_ = false;
+    std::thread flusher_;
+
+    void flusherLoop();
+    void syncPending();
+    void syncPendingLocked();
+    void openFile(uint64_t number);
+    std::vector<std::pair<uint64_t, std::string>> listFiles() const;
+    std::string filePath(uint64_t number) const;
+};
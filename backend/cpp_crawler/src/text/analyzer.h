@@ -0,0 +1,150 @@
+#pragma once
+
+#include "../utils/config_manager.h"
+#include "parser.h"
+#include "stemmer.h"
+#include "stopwords.h"
+#include "term_dictionary.h"
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// The analysis chain documents and queries both go through: tokenize and
+// case fold (with the configured normalization), drop stopwords, stem.
+// The enabled stages are fixed at construction; each call switches once
+// to a loop instantiated for exactly those stages, so a disabled stage
+// costs nothing per token and no stage is a virtual call.
+//
+// An index only answers queries analyzed the way its documents were, so
+// one Analyzer is built from the configuration and handed to both the
+// indexing and the search side.
+class Analyzer {
+public:
+    struct Options {
+        TextParser::Normalization normalization = TextParser::Normalization::NfkcLite;
+        bool stopwords = false;
+        StopWords::Language language = StopWords::Language::English;
+        bool stem = false;          // Porter2, meant for English text
+
+        bool operator==(const Options& other) const {
+            return normalization == other.normalization && stopwords == other.stopwords &&
+                   language == other.language && stem == other.stem;
+        }
+        bool operator!=(const Options& other) const { return !(*this == other); }
+    };
+
+    Analyzer() = default;
+    explicit Analyzer(const Options& options) : options_(options) {}
+    explicit Analyzer(const ConfigManager& config) : options_(optionsFrom(config)) {}
+
+    // Keys: analyzer.normalization (nfkc-lite or none), analyzer.stopwords,
+    // analyzer.language (en, fr, de or es) and analyzer.stem
+    static Options optionsFrom(const ConfigManager& config) {
+        Options options;
+        std::string normalization = config.getString("analyzer.normalization", "nfkc-lite");
+        if (normalization == "none") {
+            options.normalization = TextParser::Normalization::None;
+        } else if (normalization != "nfkc-lite") {
+            throw std::invalid_argument("Unknown analyzer.normalization: " + normalization);
+        }
+        options.stopwords = config.getBool("analyzer.stopwords", options.stopwords);
+        options.language = language(config.getString("analyzer.language", "en"));
+        options.stem = config.getBool("analyzer.stem", options.stem);
+        return options;
+    }
+
+    static StopWords::Language language(const std::string& code) {
+        if (code == "en") return StopWords::Language::English;
+        if (code == "fr") return StopWords::Language::French;
+        if (code == "de") return StopWords::Language::German;
+        if (code == "es") return StopWords::Language::Spanish;
+        throw std::invalid_argument("Unknown analyzer language: " + code);
+    }
+
+    const Options& options() const { return options_; }
+
+    // Calls f(term, position) for every term of text, with term valid
+    // until f returns; folded is scratch the caller reuses. Positions
+    // count the tokens the stopword stage dropped, so phrases keep their
+    // gaps. Returns the number of terms.
+    template <typename F>
+    size_t forEachTerm(std::string_view text, std::string& folded, F&& f) const {
+        return dispatch(text, folded, [&f](std::string_view, std::string_view term, size_t position) {
+            f(term, position);
+        });
+    }
+
+    // As forEachTerm, but f(term_id, position), interning the terms the
+    // dictionary has not seen
+    template <typename F>
+    size_t forEachTermId(std::string_view text, std::string& folded, TermDictionary& dictionary,
+                         F&& f) const {
+        return dispatch(text, folded, [&](std::string_view, std::string_view term, size_t position) {
+            f(dictionary.intern(term), position);
+        });
+    }
+
+    // Term spans into folded. A stem is never longer than its token, so
+    // it is written over the token's own bytes.
+    void termSpans(std::string_view text, std::string& folded, std::vector<TextParser::Span>& spans) const {
+        spans.clear();
+        dispatch(text, folded, [&](std::string_view token, std::string_view term, size_t) {
+            size_t offset = token.data() - folded.data();
+            if (term.data() != token.data()) std::memcpy(&folded[offset], term.data(), term.size());
+            spans.push_back({static_cast<uint32_t>(offset), static_cast<uint32_t>(term.size())});
+        });
+    }
+
+    std::vector<std::string> analyze(std::string_view text) const {
+        std::vector<std::string> terms;
+        std::string folded;
+        forEachTerm(text, folded, [&](std::string_view term, size_t) {
+            terms.emplace_back(term);
+        });
+        return terms;
+    }
+
+    // Query terms as ids. Lookups never intern: a term the dictionary has
+    // not seen is in no document, so it is dropped.
+    std::vector<uint32_t> queryTermIds(std::string_view text, const TermDictionary& dictionary) const {
+        std::vector<uint32_t> ids;
+        std::string folded;
+        forEachTerm(text, folded, [&](std::string_view term, size_t) {
+            uint32_t id = dictionary.find(term);
+            if (id != TermDictionary::kNoTerm) ids.push_back(id);
+        });
+        return ids;
+    }
+
+private:
+    Options options_;
+
+    template <typename F>
+    size_t dispatch(std::string_view text, std::string& folded, F&& f) const {
+        if (options_.stopwords) {
+            return options_.stem ? run<true, true>(text, folded, f) : run<true, false>(text, folded, f);
+        }
+        return options_.stem ? run<false, true>(text, folded, f) : run<false, false>(text, folded, f);
+    }
+
+    // f(token, term, position), token viewing folded
+    template <bool kStopwords, bool kStem, typename F>
+    size_t run(std::string_view text, std::string& folded, F& f) const {
+        size_t count = 0;
+        StopWords::Language language = options_.language;
+        TextParser::forEachToken(text, folded, [&](std::string_view token, size_t position) {
+            if constexpr (kStopwords) {
+                if (StopWords::isStopWord(token, language)) return;
+            }
+            std::string_view term = token;
+            if constexpr (kStem) {
+                term = Stemmer::stemCached(token);
+            }
+            f(token, term, position);
+            count++;
+        }, options_.normalization);
+        return count;
+    }
+};
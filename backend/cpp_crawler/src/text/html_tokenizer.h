@@ -0,0 +1,409 @@
+#pragma once
+
+#include "unicode.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Single-pass HTML tokenizer: a state machine over a byte buffer that
+// yields start tags with their attributes, end tags, text, comments and
+// doctypes in document order, each as views into the buffer. It follows
+// the shape of the HTML5 tokenizer closely enough for extraction (raw
+// text in script and style, RCDATA in title and textarea, unquoted and
+// valueless attributes, stray '<' in text) without building a tree.
+//
+//     HtmlTokenizer tokens(html);
+//     while (tokens.next()) {
+//         if (tokens.type() == HtmlTokenizer::StartTag && tokens.is("a")) {
+//             links.emplace_back(tokens.attribute("href"));
+//         }
+//     }
+class HtmlTokenizer {
+public:
+    enum Type {
+        StartTag,
+        EndTag,
+        Text,       // character data; entities are still encoded
+        RawText,    // script or style body
+        Comment,
+        Doctype,    // also <?...?> and other bogus markup declarations
+    };
+
+    struct Attribute {
+        std::string_view name;   // as written
+        std::string_view value;  // without quotes, entities still encoded
+    };
+
+    HtmlTokenizer() = default;
+    explicit HtmlTokenizer(std::string_view html) : html_(html) {}
+
+    // Starts over on another buffer, keeping allocated capacity
+    void reset(std::string_view html) {
+        html_ = html;
+        pos_ = 0;
+        raw_end_ = {};
+        attributes_.clear();
+    }
+
+    // Moves to the next token; false once the input is exhausted
+    bool next() {
+        attributes_.clear();
+        name_ = {};
+        text_ = {};
+        self_closing_ = false;
+
+        while (pos_ < html_.size()) {
+            if (!raw_end_.empty()) {
+                if (nextRawText()) return true;
+                continue;
+            }
+            if (html_[pos_] != '<' || !startsMarkup(pos_)) {
+                return nextText();
+            }
+            if (nextMarkup()) return true;
+        }
+        return false;
+    }
+
+    Type type() const { return type_; }
+
+    // Tag name as written, for StartTag and EndTag
+    std::string_view name() const { return name_; }
+
+    // Body of Text, RawText, Comment and Doctype tokens
+    std::string_view text() const { return text_; }
+
+    // Byte offset of the current token in the buffer
+    size_t offset() const { return offset_; }
+
+    bool selfClosing() const { return self_closing_; }
+
+    const std::vector<Attribute>& attributes() const { return attributes_; }
+
+    // Case-insensitive tag name test; tag must be lowercase
+    bool is(std::string_view tag) const { return equalsNoCase(name_, tag); }
+
+    // Value of the first attribute with this lowercase name, empty if the
+    // tag has none
+    std::string_view attribute(std::string_view name) const {
+        for (const auto& attribute : attributes_) {
+            if (equalsNoCase(attribute.name, name)) return attribute.value;
+        }
+        return {};
+    }
+
+    bool hasAttribute(std::string_view name) const {
+        for (const auto& attribute : attributes_) {
+            if (equalsNoCase(attribute.name, name)) return true;
+        }
+        return false;
+    }
+
+    // Compares ASCII case-insensitively against a lowercase string
+    static bool equalsNoCase(std::string_view text, std::string_view lower) {
+        if (text.size() != lower.size()) return false;
+        for (size_t i = 0; i < text.size(); ++i) {
+            if (toLower(text[i]) != lower[i]) return false;
+        }
+        return true;
+    }
+
+    // Appends text to out with character references decoded: the common
+    // named entities and decimal or hex numeric ones. Anything else,
+    // including names this table lacks, is copied as written.
+    static void decodeEntities(std::string_view text, std::string& out) {
+        size_t pos = 0;
+        while (pos < text.size()) {
+            const void* amp = std::memchr(text.data() + pos, '&', text.size() - pos);
+            size_t at = amp ? static_cast<const char*>(amp) - text.data() : text.size();
+            out.append(text.data() + pos, at - pos);
+            if (at == text.size()) break;
+
+            size_t length;
+            uint32_t cp = decodeReference(text, at, length);
+            if (length == 0) {
+                out.push_back('&');
+                pos = at + 1;
+            } else {
+                char buffer[Unicode::kMaxEncodedBytes];
+                out.append(buffer, Unicode::encode(cp, buffer));
+                pos = at + length;
+            }
+        }
+    }
+
+    static std::string decodeEntities(std::string_view text) {
+        std::string out;
+        out.reserve(text.size());
+        decodeEntities(text, out);
+        return out;
+    }
+
+private:
+    std::string_view html_;
+    size_t pos_ = 0;
+    Type type_ = Text;
+    size_t offset_ = 0;
+    std::string_view name_;
+    std::string_view text_;
+    bool self_closing_ = false;
+    // While inside script, style, title or textarea: the end tag that
+    // closes it, and whether the body is raw text or RCDATA
+    std::string_view raw_end_;
+    Type raw_type_ = RawText;
+    std::vector<Attribute> attributes_;
+
+    static char toLower(char c) {
+        return c >= 'A' && c <= 'Z' ? static_cast<char>(c + ('a' - 'A')) : c;
+    }
+
+    static bool isSpace(char c) {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+    }
+
+    static bool isAlpha(char c) {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+    }
+
+    // Whether the '<' at pos opens markup rather than being literal text
+    bool startsMarkup(size_t pos) const {
+        if (pos + 1 >= html_.size()) return false;
+        char c = html_[pos + 1];
+        return isAlpha(c) || c == '!' || c == '?' ||
+            (c == '/' && pos + 2 < html_.size() && (isAlpha(html_[pos + 2]) || html_[pos + 2] == '>'));
+    }
+
+    void emit(Type type, size_t offset) {
+        type_ = type;
+        offset_ = offset;
+    }
+
+    bool nextText() {
+        size_t start = pos_;
+        size_t scan = pos_ + 1;
+        while (scan < html_.size()) {
+            const void* lt = std::memchr(html_.data() + scan, '<', html_.size() - scan);
+            if (!lt) {
+                scan = html_.size();
+                break;
+            }
+            scan = static_cast<const char*>(lt) - html_.data();
+            if (startsMarkup(scan)) break;
+            ++scan;
+        }
+        pos_ = std::min(scan, html_.size());
+        text_ = html_.substr(start, pos_ - start);
+        emit(Text, start);
+        return true;
+    }
+
+    // Body of a raw text or RCDATA element, up to its end tag
+    bool nextRawText() {
+        size_t start = pos_;
+        size_t end = findEndTag(raw_end_, pos_);
+        raw_end_ = {};
+        pos_ = end;
+        if (end == start) return false;
+        text_ = html_.substr(start, end - start);
+        emit(raw_type_, start);
+        return true;
+    }
+
+    size_t findEndTag(std::string_view name, size_t from) const {
+        size_t scan = from;
+        while (scan < html_.size()) {
+            const void* lt = std::memchr(html_.data() + scan, '<', html_.size() - scan);
+            if (!lt) break;
+            scan = static_cast<const char*>(lt) - html_.data();
+            size_t after = scan + 2 + name.size();
+            if (scan + 1 < html_.size() && html_[scan + 1] == '/' && after <= html_.size() &&
+                equalsNoCase(html_.substr(scan + 2, name.size()), name) &&
+                (after == html_.size() || isSpace(html_[after]) || html_[after] == '/' || html_[after] == '>')) {
+                return scan;
+            }
+            ++scan;
+        }
+        return html_.size();
+    }
+
+    // pos_ is at a '<' that starts markup
+    bool nextMarkup() {
+        size_t start = pos_;
+        char c = html_[pos_ + 1];
+        if (c == '!') {
+            if (html_.compare(pos_, 4, "<!--") == 0) {
+                size_t end = html_.find("-->", pos_ + 4);
+                size_t stop = end == std::string_view::npos ? html_.size() : end;
+                text_ = html_.substr(pos_ + 4, stop - pos_ - 4);
+                pos_ = end == std::string_view::npos ? html_.size() : end + 3;
+                emit(Comment, start);
+                return true;
+            }
+            return nextDeclaration(start, 2);
+        }
+        if (c == '?') {
+            return nextDeclaration(start, 2);
+        }
+        if (c == '/') {
+            if (html_[pos_ + 2] == '>') {
+                pos_ += 3;  // "</>" is dropped
+                return false;
+            }
+            pos_ += 2;
+            if (!readTag()) return false;
+            emit(EndTag, start);
+            attributes_.clear();
+            return true;
+        }
+
+        pos_ += 1;
+        if (!readTag()) return false;
+        emit(StartTag, start);
+        if (!self_closing_) {
+            if (is("script") || is("style")) {
+                raw_end_ = is("script") ? "script" : "style";
+                raw_type_ = RawText;
+            } else if (is("title") || is("textarea")) {
+                raw_end_ = is("title") ? "title" : "textarea";
+                raw_type_ = Text;
+            }
+        }
+        return true;
+    }
+
+    bool nextDeclaration(size_t start, size_t skip) {
+        size_t end = html_.find('>', start + skip);
+        size_t stop = end == std::string_view::npos ? html_.size() : end;
+        text_ = html_.substr(start + skip, stop - start - skip);
+        pos_ = end == std::string_view::npos ? html_.size() : end + 1;
+        emit(Doctype, start);
+        return true;
+    }
+
+    // Reads a tag name and its attributes up to and past the closing '>'.
+    // A tag cut off by the end of input is dropped, as HTML5 does.
+    bool readTag() {
+        size_t size = html_.size();
+        size_t start = pos_;
+        while (pos_ < size && !isSpace(html_[pos_]) && html_[pos_] != '/' && html_[pos_] != '>') {
+            ++pos_;
+        }
+        name_ = html_.substr(start, pos_ - start);
+
+        while (pos_ < size) {
+            char c = html_[pos_];
+            if (isSpace(c)) {
+                ++pos_;
+                continue;
+            }
+            if (c == '>') {
+                ++pos_;
+                return true;
+            }
+            if (c == '/') {
+                ++pos_;
+                self_closing_ = pos_ < size && html_[pos_] == '>';
+                continue;
+            }
+
+            size_t name_start = pos_++;
+            while (pos_ < size && !isSpace(html_[pos_]) && html_[pos_] != '/' &&
+                   html_[pos_] != '>' && html_[pos_] != '=') {
+                ++pos_;
+            }
+            Attribute attribute{html_.substr(name_start, pos_ - name_start), {}};
+
+            size_t after_name = pos_;
+            while (pos_ < size && isSpace(html_[pos_])) ++pos_;
+            if (pos_ < size && html_[pos_] == '=') {
+                ++pos_;
+                while (pos_ < size && isSpace(html_[pos_])) ++pos_;
+                if (pos_ < size && (html_[pos_] == '"' || html_[pos_] == '\'')) {
+                    char quote = html_[pos_++];
+                    const void* end = std::memchr(html_.data() + pos_, quote, size - pos_);
+                    if (!end) break;
+                    size_t stop = static_cast<const char*>(end) - html_.data();
+                    attribute.value = html_.substr(pos_, stop - pos_);
+                    pos_ = stop + 1;
+                } else {
+                    size_t value_start = pos_;
+                    while (pos_ < size && !isSpace(html_[pos_]) && html_[pos_] != '>') ++pos_;
+                    attribute.value = html_.substr(value_start, pos_ - value_start);
+                }
+            } else {
+                pos_ = after_name;
+            }
+            attributes_.push_back(attribute);
+        }
+        pos_ = size;
+        return false;
+    }
+
+    // Character reference at text[at] == '&': its codepoint and length,
+    // or length 0 if it is not one
+    static uint32_t decodeReference(std::string_view text, size_t at, size_t& length) {
+        length = 0;
+        size_t i = at + 1;
+        if (i < text.size() && text[i] == '#') {
+            bool hex = i + 1 < text.size() && (text[i + 1] == 'x' || text[i + 1] == 'X');
+            i += hex ? 2 : 1;
+            size_t digits_start = i;
+            uint32_t cp = 0;
+            for (; i < text.size(); ++i) {
+                char c = text[i];
+                int digit = c >= '0' && c <= '9' ? c - '0'
+                    : hex && toLower(c) >= 'a' && toLower(c) <= 'f' ? toLower(c) - 'a' + 10 : -1;
+                if (digit < 0) break;
+                cp = std::min<uint32_t>(cp * (hex ? 16 : 10) + digit, 0x110000);
+            }
+            if (i == digits_start) return 0;
+            if (i < text.size() && text[i] == ';') ++i;
+            length = i - at;
+            bool invalid = cp == 0 || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF);
+            return invalid ? Unicode::kReplacement : cp;
+        }
+
+        size_t name_start = i;
+        while (i < text.size() && i - name_start < kMaxEntityName &&
+               (isAlpha(text[i]) || (text[i] >= '0' && text[i] <= '9'))) {
+            ++i;
+        }
+        if (i == name_start || i >= text.size() || text[i] != ';') return 0;
+
+        std::string_view name = text.substr(name_start, i - name_start);
+        for (const auto& entity : kEntities) {
+            if (name == entity.name) {
+                length = i + 1 - at;
+                return entity.codepoint;
+            }
+        }
+        return 0;
+    }
+
+    struct Entity {
+        const char* name;
+        uint32_t codepoint;
+    };
+
+    static constexpr size_t kMaxEntityName = 8;
+
+    // nbsp decodes to a plain space so it separates words like one
+    static constexpr Entity kEntities[] = {
+        {"amp", '&'}, {"lt", '<'}, {"gt", '>'}, {"quot", '"'}, {"apos", '\''},
+        {"nbsp", ' '}, {"copy", 0xA9}, {"reg", 0xAE}, {"trade", 0x2122},
+        {"mdash", 0x2014}, {"ndash", 0x2013}, {"hellip", 0x2026}, {"middot", 0xB7},
+        {"bull", 0x2022}, {"lsquo", 0x2018}, {"rsquo", 0x2019}, {"sbquo", 0x201A},
+        {"ldquo", 0x201C}, {"rdquo", 0x201D}, {"bdquo", 0x201E}, {"laquo", 0xAB},
+        {"raquo", 0xBB}, {"euro", 0x20AC}, {"pound", 0xA3}, {"yen", 0xA5},
+        {"cent", 0xA2}, {"sect", 0xA7}, {"para", 0xB6}, {"deg", 0xB0},
+        {"plusmn", 0xB1}, {"times", 0xD7}, {"divide", 0xF7}, {"frac12", 0xBD},
+        {"shy", 0xAD}, {"iexcl", 0xA1}, {"iquest", 0xBF}, {"szlig", 0xDF},
+        {"auml", 0xE4}, {"ouml", 0xF6}, {"uuml", 0xFC}, {"Auml", 0xC4},
+        {"Ouml", 0xD6}, {"Uuml", 0xDC}, {"eacute", 0xE9}, {"egrave", 0xE8},
+        {"aacute", 0xE1}, {"agrave", 0xE0}, {"oacute", 0xF3}, {"iacute", 0xED},
+        {"uacute", 0xFA}, {"ntilde", 0xF1}, {"ccedil", 0xE7}, {"Eacute", 0xC9},
+    };
+};
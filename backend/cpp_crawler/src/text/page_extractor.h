@@ -0,0 +1,513 @@
+#pragma once
+
+#include "analyzer.h"
+#include "html_tokenizer.h"
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Everything the crawler and indexer take from a page, filled by one
+// PageExtractor pass over its HTML. Meant to be reused: clear() keeps
+// the capacity of every buffer, so a worker that extracts page after
+// page into the same ExtractedPage stops allocating once it has seen a
+// large one.
+struct ExtractedPage {
+    // A byte range within one of the page's buffers
+    struct Range {
+        uint32_t offset = 0;
+        uint32_t length = 0;
+    };
+
+    // Outlink as written in the page (entities decoded, not resolved),
+    // with its anchor text; both are ranges of link_text
+    struct Link {
+        Range url;
+        Range anchor;
+        bool nofollow = false;
+    };
+
+    // Whitespace-collapsed and trimmed. The title falls back to the first
+    // <h1>, og:title and meta title; the description to og:description
+    // and the first paragraph.
+    std::string title;
+    std::string description;
+    std::string keywords;
+    std::string author;
+    std::string language;       // meta language, else <html lang>
+    std::string robots;
+    std::string og_title;
+    std::string og_description;
+    std::string og_type;
+    std::string og_image;
+    std::string base_href;      // first <base href>, as written
+
+    // Visible text in document order: no script, style, title, template
+    // or noscript bodies, entities decoded, whitespace collapsed, block
+    // tags as spaces
+    std::string text;
+    // The main content within text: the first <main>, <article>,
+    // div.content, div#content or <body> found, else all of it
+    Range main_content;
+
+    std::vector<Link> links;
+    std::string link_text;
+
+    // Terms of text as the extractor's Analyzer produced them, as spans
+    // into folded
+    std::string folded;
+    std::vector<TextParser::Span> tokens;
+
+    bool has_code_blocks = false;  // <pre> or <code>
+    bool has_images = false;       // <img> or <picture>
+    bool has_videos = false;       // <video>, or an embed or link to a video site
+
+    std::string_view url(const Link& link) const { return slice(link_text, link.url); }
+    std::string_view anchorText(const Link& link) const { return slice(link_text, link.anchor); }
+    std::string_view mainContent() const { return slice(text, main_content); }
+    std::string_view token(const TextParser::Span& span) const {
+        return std::string_view(folded).substr(span.offset, span.length);
+    }
+
+    void clear() {
+        for (std::string* field : {&title, &description, &keywords, &author, &language, &robots,
+                                   &og_title, &og_description, &og_type, &og_image, &base_href,
+                                   &text, &link_text, &folded}) {
+            field->clear();
+        }
+        main_content = {};
+        links.clear();
+        tokens.clear();
+        has_code_blocks = has_images = has_videos = false;
+    }
+
+private:
+    static std::string_view slice(const std::string& buffer, Range range) {
+        return std::string_view(buffer).substr(range.offset, range.length);
+    }
+};
+
+// Walks a page's HTML once with an HtmlTokenizer and fills an
+// ExtractedPage: metadata, outlinks with anchor text, visible text and
+// its analyzed terms, and feature flags. One extractor per thread; it
+// keeps its tokenizer and scratch buffers between pages.
+//
+//     PageExtractor extractor;
+//     ExtractedPage page;
+//     for (const auto& html : pages) {
+//         extractor.extract(html, page);
+//         for (const auto& link : page.links) follow(page.url(link));
+//     }
+class PageExtractor {
+public:
+    explicit PageExtractor(const Analyzer& analyzer = Analyzer()) : analyzer_(analyzer) {}
+
+    // Replaces the contents of page; pages must be under 4 GB
+    void extract(std::string_view html, ExtractedPage& page) {
+        page.clear();
+        h1_.clear();
+        paragraph_.clear();
+        meta_title_.clear();
+        html_lang_.clear();
+        for (auto& range : content_) range = {};
+        in_title_ = in_h1_ = in_paragraph_ = false;
+        hidden_depth_ = 0;
+        link_ = kNoLink;
+
+        tokens_.reset(html);
+        while (tokens_.next()) {
+            switch (tokens_.type()) {
+                case HtmlTokenizer::StartTag:
+                    startTag(page);
+                    break;
+                case HtmlTokenizer::EndTag:
+                    endTag(page);
+                    break;
+                case HtmlTokenizer::Text:
+                    text(page);
+                    break;
+                default:
+                    // Script and style bodies, comments and doctypes hold
+                    // no page text
+                    break;
+            }
+        }
+        finish(page);
+        analyzer_.termSpans(page.text, page.folded, page.tokens);
+    }
+
+private:
+    static constexpr size_t kNoLink = static_cast<size_t>(-1);
+    static constexpr size_t kMaxTagName = 8;
+
+    enum Tag : uint8_t {
+        Other, Inline, A, Area, Article, Base, Body, Code, Div, Embed, H1, Html, Iframe, Img,
+        Main, Meta, Noscript, P, Picture, Pre, Template, Title, Video
+    };
+
+    // Elements whose text can serve as the main content, best first
+    enum ContentCandidate { MainElement, ArticleElement, ContentClass, ContentId, BodyElement, kCandidates };
+
+    struct ContentRange {
+        bool open = false;
+        bool found = false;
+        int depth = 0;  // of elements with the candidate's tag name
+        size_t begin = 0;
+        size_t end = 0;
+    };
+
+    Analyzer analyzer_;
+    HtmlTokenizer tokens_;
+    std::string h1_;
+    std::string paragraph_;
+    std::string meta_title_;
+    std::string html_lang_;
+    ContentRange content_[kCandidates];
+    bool in_title_ = false;
+    bool in_h1_ = false;
+    bool in_paragraph_ = false;
+    int hidden_depth_ = 0;   // open elements whose text is not shown
+    size_t link_ = kNoLink;  // index of the open <a>, if any
+
+    void startTag(ExtractedPage& page) {
+        const auto& tag = tokens_;
+        Tag kind = classify(tag.name());
+        switch (kind) {
+            case Title:
+                in_title_ = page.title.empty();
+                break;
+            case H1:
+                in_h1_ = h1_.empty();
+                break;
+            case P:
+                in_paragraph_ = paragraph_.empty();
+                break;
+            case Meta:
+                meta(page);
+                break;
+            case A:
+            case Area:
+                closeLink(page);
+                if (tag.hasAttribute("href")) openLink(page, kind);
+                break;
+            case Img:
+                page.has_images = true;
+                // An image link's alt text is its anchor text
+                if (link_ != kNoLink) appendText(tag.attribute("alt"), page.link_text, anchorBegin(page));
+                break;
+            case Picture:
+                page.has_images = true;
+                break;
+            case Pre:
+            case Code:
+                page.has_code_blocks = true;
+                break;
+            case Video:
+                page.has_videos = true;
+                break;
+            case Iframe:
+            case Embed:
+                page.has_videos |= isVideoUrl(tag.attribute("src"));
+                break;
+            case Base:
+                if (page.base_href.empty()) trimmed(tag.attribute("href"), page.base_href);
+                break;
+            case Html:
+                if (html_lang_.empty()) appendText(tag.attribute("lang"), html_lang_);
+                break;
+            default:
+                break;
+        }
+        if (!tag.selfClosing() && isHidden(kind)) hidden_depth_++;
+
+        if (!isInline(kind)) separate(page);
+        if (!isCandidateTag(kind)) return;
+        for (int candidate = 0; candidate < kCandidates; ++candidate) {
+            auto& range = content_[candidate];
+            if (range.open && kind == candidateTag(candidate)) {
+                range.depth++;
+            } else if (!range.open && !range.found && startsCandidate(candidate, kind)) {
+                range.open = true;
+                range.depth = 1;
+                range.begin = page.text.size();
+            }
+        }
+    }
+
+    void endTag(ExtractedPage& page) {
+        Tag kind = classify(tokens_.name());
+        switch (kind) {
+            case Title:
+                in_title_ = false;
+                break;
+            case H1:
+                in_h1_ = false;
+                break;
+            case P:
+                in_paragraph_ = false;
+                break;
+            case A:
+            case Area:
+                closeLink(page);
+                break;
+            default:
+                break;
+        }
+        if (hidden_depth_ > 0 && isHidden(kind)) hidden_depth_--;
+
+        if (isCandidateTag(kind)) {
+            for (int candidate = 0; candidate < kCandidates; ++candidate) {
+                auto& range = content_[candidate];
+                if (range.open && kind == candidateTag(candidate) && --range.depth == 0) {
+                    range.open = false;
+                    range.found = true;
+                    range.end = page.text.size();
+                }
+            }
+        }
+        if (!isInline(kind)) separate(page);
+    }
+
+    void text(ExtractedPage& page) {
+        std::string_view text = tokens_.text();
+        if (in_title_) appendText(text, page.title);
+        if (hidden_depth_ > 0) return;
+        if (in_h1_) appendText(text, h1_);
+        if (in_paragraph_) appendText(text, paragraph_);
+        appendText(text, page.text);
+        if (link_ != kNoLink) appendText(text, page.link_text, anchorBegin(page));
+    }
+
+    // The first tag for a given name or property wins
+    void meta(ExtractedPage& page) {
+        const auto& tag = tokens_;
+        std::string_view content = tag.attribute("content");
+        std::string_view name = tag.attribute("name");
+        std::string* field = nullptr;
+        if (HtmlTokenizer::equalsNoCase(name, "description")) {
+            field = &page.description;
+        } else if (HtmlTokenizer::equalsNoCase(name, "keywords")) {
+            field = &page.keywords;
+        } else if (HtmlTokenizer::equalsNoCase(name, "author")) {
+            field = &page.author;
+        } else if (HtmlTokenizer::equalsNoCase(name, "language")) {
+            field = &page.language;
+        } else if (HtmlTokenizer::equalsNoCase(name, "robots")) {
+            field = &page.robots;
+        } else if (HtmlTokenizer::equalsNoCase(name, "title")) {
+            field = &meta_title_;
+        }
+        if (field && field->empty()) appendText(content, *field);
+
+        std::string_view property = tag.attribute("property");
+        field = nullptr;
+        if (HtmlTokenizer::equalsNoCase(property, "og:title")) {
+            field = &page.og_title;
+        } else if (HtmlTokenizer::equalsNoCase(property, "og:description")) {
+            field = &page.og_description;
+        } else if (HtmlTokenizer::equalsNoCase(property, "og:type")) {
+            field = &page.og_type;
+        } else if (HtmlTokenizer::equalsNoCase(property, "og:image")) {
+            field = &page.og_image;
+        }
+        if (field && field->empty()) appendText(content, *field);
+    }
+
+    void openLink(ExtractedPage& page, Tag kind) {
+        std::string_view href = tokens_.attribute("href");
+        ExtractedPage::Link link;
+        link.url.offset = static_cast<uint32_t>(page.link_text.size());
+        trimmed(href, page.link_text);
+        link.url.length = static_cast<uint32_t>(page.link_text.size() - link.url.offset);
+        link.anchor.offset = static_cast<uint32_t>(page.link_text.size());
+        link.nofollow = containsNoCase(tokens_.attribute("rel"), "nofollow");
+        page.has_videos |= isVideoUrl(page.url(link));
+        page.links.push_back(link);
+        // <area> is a void element: it has no anchor text to collect
+        link_ = kind == A && !tokens_.selfClosing() ? page.links.size() - 1 : kNoLink;
+    }
+
+    void closeLink(ExtractedPage& page) {
+        if (link_ == kNoLink) return;
+        auto& link = page.links[link_];
+        if (page.link_text.size() > anchorBegin(page) && page.link_text.back() == ' ') {
+            page.link_text.pop_back();
+        }
+        link.anchor.length = static_cast<uint32_t>(page.link_text.size() - link.anchor.offset);
+        link_ = kNoLink;
+    }
+
+    // A tag that breaks words breaks them in every text being collected
+    void separate(ExtractedPage& page) {
+        separate(page.text);
+        if (in_h1_ && !h1_.empty()) separate(h1_);
+        if (in_paragraph_ && !paragraph_.empty()) separate(paragraph_);
+        if (link_ != kNoLink && page.link_text.size() > anchorBegin(page)) separate(page.link_text);
+    }
+
+    size_t anchorBegin(const ExtractedPage& page) const {
+        return page.links[link_].anchor.offset;
+    }
+
+    void finish(ExtractedPage& page) {
+        closeLink(page);
+        // Elements left open at the end of the page run to its end
+        for (auto& range : content_) {
+            if (range.open) {
+                range.open = false;
+                range.found = true;
+                range.end = page.text.size();
+            }
+        }
+        page.main_content = {0, static_cast<uint32_t>(page.text.size())};
+        for (const auto& range : content_) {
+            if (range.found) {
+                page.main_content = {static_cast<uint32_t>(range.begin),
+                                     static_cast<uint32_t>(range.end - range.begin)};
+                break;
+            }
+        }
+        trimRange(page.text, page.main_content);
+
+        for (const std::string* fallback : {&h1_, &page.og_title, &meta_title_}) {
+            if (!page.title.empty()) break;
+            page.title = *fallback;
+        }
+        for (const std::string* fallback : {&page.og_description, &paragraph_}) {
+            if (!page.description.empty()) break;
+            page.description = *fallback;
+        }
+        if (page.language.empty()) page.language = html_lang_;
+        for (std::string* field : {&page.title, &page.description, &page.text}) {
+            if (!field->empty() && field->back() == ' ') field->pop_back();
+        }
+    }
+
+    // Appends text with entities decoded and whitespace and control
+    // characters collapsed into single spaces; no space is written at
+    // `floor` or after another space
+    static void appendText(std::string_view text, std::string& out, size_t floor = 0) {
+        size_t from = out.size();
+        HtmlTokenizer::decodeEntities(text, out);
+        bool space = from == floor || out[from - 1] == ' ';
+        // Most text needs no rewriting: only scan up to the first byte
+        // that does
+        size_t to = from;
+        for (; to < out.size(); ++to) {
+            char c = out[to];
+            if (static_cast<unsigned char>(c) < ' ' || (c == ' ' && space)) break;
+            space = c == ' ';
+        }
+        for (size_t i = to; i < out.size(); ++i) {
+            char c = out[i];
+            if (static_cast<unsigned char>(c) <= ' ') {
+                if (!space) out[to++] = ' ';
+                space = true;
+            } else {
+                out[to++] = c;
+                space = false;
+            }
+        }
+        out.resize(to);
+    }
+
+    // Appends an attribute value with entities decoded and surrounding
+    // whitespace removed
+    static void trimmed(std::string_view value, std::string& out) {
+        size_t from = out.size();
+        HtmlTokenizer::decodeEntities(value, out);
+        size_t begin = from;
+        while (begin < out.size() && static_cast<unsigned char>(out[begin]) <= ' ') begin++;
+        size_t end = out.size();
+        while (end > begin && static_cast<unsigned char>(out[end - 1]) <= ' ') end--;
+        out.erase(end);
+        out.erase(from, begin - from);
+    }
+
+    static void separate(std::string& text) {
+        if (!text.empty() && text.back() != ' ') text += ' ';
+    }
+
+    static void trimRange(const std::string& text, ExtractedPage::Range& range) {
+        while (range.length > 0 && text[range.offset] == ' ') range.offset++, range.length--;
+        while (range.length > 0 && text[range.offset + range.length - 1] == ' ') range.length--;
+    }
+
+    // Tag names the extractor acts on, looked up once per tag
+    static Tag classify(std::string_view name) {
+        struct Entry {
+            const char* name;
+            Tag tag;
+        };
+        // Sorted by name
+        static const Entry kTags[] = {
+            {"a", A}, {"abbr", Inline}, {"area", Area}, {"article", Article}, {"b", Inline},
+            {"base", Base}, {"bdi", Inline}, {"bdo", Inline}, {"body", Body}, {"cite", Inline},
+            {"code", Code}, {"data", Inline}, {"dfn", Inline}, {"div", Div}, {"em", Inline},
+            {"embed", Embed}, {"font", Inline}, {"h1", H1}, {"html", Html}, {"i", Inline},
+            {"iframe", Iframe}, {"img", Img}, {"kbd", Inline}, {"main", Main}, {"mark", Inline},
+            {"meta", Meta}, {"noscript", Noscript}, {"p", P}, {"picture", Picture}, {"pre", Pre},
+            {"q", Inline}, {"s", Inline}, {"samp", Inline}, {"small", Inline}, {"span", Inline},
+            {"strong", Inline}, {"sub", Inline}, {"sup", Inline}, {"template", Template},
+            {"time", Inline}, {"title", Title}, {"tt", Inline}, {"u", Inline}, {"var", Inline},
+            {"video", Video}, {"wbr", Inline},
+        };
+        char lower[kMaxTagName];
+        if (name.size() > kMaxTagName) return Other;
+        for (size_t i = 0; i < name.size(); ++i) {
+            char c = name[i];
+            lower[i] = c >= 'A' && c <= 'Z' ? static_cast<char>(c + ('a' - 'A')) : c;
+        }
+        std::string_view key(lower, name.size());
+        const Entry* end = kTags + std::size(kTags);
+        const Entry* it = std::lower_bound(kTags, end, key, [](const Entry& entry, std::string_view key) {
+            return entry.name < key;
+        });
+        return it != end && it->name == key ? it->tag : Other;
+    }
+
+    // Phrasing elements do not separate words: "<b>W</b>ord" is one word
+    static bool isInline(Tag tag) {
+        return tag == Inline || tag == A || tag == Code;
+    }
+
+    static bool isHidden(Tag tag) {
+        return tag == Title || tag == Template || tag == Noscript;
+    }
+
+    static bool isVideoUrl(std::string_view url) {
+        return containsNoCase(url, "youtube.com/") || containsNoCase(url, "youtu.be/") ||
+               containsNoCase(url, "vimeo.com/");
+    }
+
+    // Whether text contains needle, which must be lowercase
+    static bool containsNoCase(std::string_view text, std::string_view needle) {
+        for (size_t i = 0; i + needle.size() <= text.size(); ++i) {
+            if (HtmlTokenizer::equalsNoCase(text.substr(i, needle.size()), needle)) return true;
+        }
+        return false;
+    }
+
+    static Tag candidateTag(int candidate) {
+        static const Tag tags[kCandidates] = {Main, Article, Div, Div, Body};
+        return tags[candidate];
+    }
+
+    static bool isCandidateTag(Tag tag) {
+        return tag == Main || tag == Article || tag == Div || tag == Body;
+    }
+
+    bool startsCandidate(int candidate, Tag tag) const {
+        if (tag != candidateTag(candidate)) return false;
+        switch (candidate) {
+            case ContentClass:
+                return containsNoCase(tokens_.attribute("class"), "content");
+            case ContentId:
+                return HtmlTokenizer::equalsNoCase(tokens_.attribute("id"), "content");
+            default:
+                return true;
+        }
+    }
+};
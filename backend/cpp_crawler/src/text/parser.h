@@ -1,48 +1,465 @@
 #pragma once
 
+#include "../net/url.h"
+#include "html_tokenizer.h"
+#include "unicode.h"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
 #include <vector>
 #include <string>
-#include <cctype>
+#include <string_view>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
 
 class TextParser {
 public:
-    static std::vector<std::string> tokenize(const std::string& text) {
-        std::vector<std::string> tokens;
-        std::string current;
+    // A token's byte range within the folded text
+    struct Span {
+        uint32_t offset;
+        uint32_t length;
+    };
+    
+    // NfkcLite adds NFKC compatibility mappings of single codepoints
+    // (fullwidth forms, ligatures, ...) and canonical composition of a
+    // letter with the marks that follow it, so decomposed and
+    // precomposed spellings give the same token
+    enum class Normalization { None, NfkcLite };
+    
+    // Copies the tokens of UTF-8 text case folded into `folded`, a buffer
+    // the caller reuses, and calls f(token, position) for every token,
+    // with token viewing `folded` until f returns. Tokens are runs of
+    // letters, digits, apostrophes and the marks that follow them; each
+    // Han or Hiragana character is a token by itself. Everything else
+    // separates tokens. Returns the number of tokens.
+    //
+    // All-ASCII text is folded 64 bytes at a time into a bitmask of token
+    // bytes (SIMD where available); token boundaries are the mask's bit
+    // transitions, found with count-trailing-zeros. Blocks holding other
+    // bytes are decoded codepoint by codepoint.
+    template <typename F>
+    static size_t forEachToken(std::string_view text, std::string& folded, F&& f,
+                               Normalization normalization = Normalization::NfkcLite) {
+        folded.resize(text.size());
+        const char* in = text.data();
+        size_t size = text.size();
+        BlockFolder fold_block = blockFolder();
+        Cursor cursor;
+        cursor.data = &folded[0];
+        cursor.capacity = folded.size();
         
-        for (char c : text) {
-            if (std::isalnum(c) || c == '\'') {
-                current += std::tolower(c);
-            } else if (!current.empty()) {
-                tokens.push_back(current);
-                current.clear();
+        while (cursor.in < size) {
+            // ASCII folds byte for byte, so a run of ASCII blocks can go on
+            // until the input or the buffer ends; the codepoint path grows
+            // the buffer when needed
+            size_t run_end = cursor.in + std::min(size - cursor.in, cursor.capacity - cursor.out);
+            while (run_end - cursor.in >= kBlockBytes) {
+                BlockMask block = fold_block(in + cursor.in, cursor.data + cursor.out);
+                if (!block.ascii) break;
+                foldMask(block.mask, cursor, f);
             }
+            if (cursor.in == size) break;
+            cursor = foldCodepoints(text, std::min(cursor.in + kBlockBytes, size), folded,
+                                    cursor, normalization == Normalization::NfkcLite, f);
         }
-        
-        if (!current.empty()) {
-            tokens.push_back(current);
+        if (cursor.in_token) {
+            cursor.emit(f);
         }
-        
+        folded.resize(cursor.out);
+        return cursor.count;
+    }
+    
+    // Which block folder forEachToken() uses on this machine
+    static const char* foldingPath() {
+        BlockFolder folder = blockFolder();
+#if defined(__x86_64__) || defined(__i386__)
+        if (folder == &foldAvx2) return "avx2";
+#endif
+#ifdef __SSE2__
+        if (folder == &foldSse2) return "sse2";
+#endif
+        return folder == &foldBlockScalar ? "scalar" : "unknown";
+    }
+    
+    // Token spans into `folded`; offsets are 32-bit, so text must be
+    // under 4 GB
+    static void tokenSpans(std::string_view text, std::string& folded, std::vector<Span>& spans,
+                           Normalization normalization = Normalization::NfkcLite) {
+        spans.clear();
+        forEachToken(text, folded, [&](std::string_view token, size_t) {
+            spans.push_back({static_cast<uint32_t>(token.data() - folded.data()),
+                             static_cast<uint32_t>(token.size())});
+        }, normalization);
+    }
+    
+    static std::vector<std::string> tokenize(std::string_view text,
+                                             Normalization normalization = Normalization::NfkcLite) {
+        std::vector<std::string> tokens;
+        std::string folded;
+        forEachToken(text, folded, [&](std::string_view token, size_t) {
+            tokens.emplace_back(token);
+        }, normalization);
         return tokens;
     }
     
-    static std::vector<std::string> extractLinks(const std::string& html) {
+    // Canonical http(s) URLs of the page's <a> and <area> links, with
+    // relative links resolved against <base href> or else base_url, the
+    // page's own URL. Without a base only absolute links are kept.
+    static std::vector<std::string> extractLinks(std::string_view html, std::string_view base_url = {}) {
         std::vector<std::string> links;
-        size_t pos = 0;
+        std::string base(base_url);
+        std::string href;
+        std::string link;
+        HtmlTokenizer tokens(html);
+        while (tokens.next()) {
+            if (tokens.type() != HtmlTokenizer::StartTag) continue;
+            if (tokens.is("base") && tokens.hasAttribute("href")) {
+                HtmlTokenizer::decodeEntities(tokens.attribute("href"), href);
+                if (Url::resolve(base_url, href, link)) base = link;
+                href.clear();
+            } else if ((tokens.is("a") || tokens.is("area")) && tokens.hasAttribute("href")) {
+                HtmlTokenizer::decodeEntities(tokens.attribute("href"), href);
+                if (Url::resolve(base, href, link)) links.push_back(link);
+                href.clear();
+            }
+        }
+        return links;
+    }
+
+private:
+    static constexpr size_t kBlockBytes = 64;
+    // Output of one input codepoint at most: a compatibility mapping of
+    // kMaxMapping codepoints
+    static constexpr size_t kMaxCodepointBytes = UnicodeData::kMaxMapping * Unicode::kMaxEncodedBytes;
+    static constexpr size_t kNone = static_cast<size_t>(-1);
+    
+    // Position in the input and in the folded output, which differ once
+    // folding changes a codepoint's length. The output buffer is held as
+    // a raw pointer so that callbacks do not force it to be reloaded.
+    struct Cursor {
+        char* data = nullptr;
+        size_t capacity = 0;
+        size_t in = 0;
+        size_t out = 0;
+        size_t count = 0;
+        size_t start = 0;         // of the current token in the output
+        bool in_token = false;
+        size_t last = kNone;      // output position of the current token's
+                                  // last codepoint, if marks may compose with it
         
-        while ((pos = html.find("href=\"", pos)) != std::string::npos) {
-            pos += 6; // Skip href="
-            size_t end = html.find("\"", pos);
-            if (end == std::string::npos) break;
+        template <typename F>
+        void emit(F& f) {
+            f(std::string_view(data + start, out - start), count++);
+            in_token = false;
+        }
+    };
+    
+    // Token mask of a 64-byte block, bit i set if byte i belongs to a
+    // token; only valid if the block is all ASCII
+    struct BlockMask {
+        uint64_t mask;
+        bool ascii;
+    };
+    
+    // Folds one all-ASCII 64-byte block into out; leaves out alone if the
+    // block holds other bytes
+    using BlockFolder = BlockMask (*)(const char* in, char* out);
+    
+    static void reserve(std::string& folded, Cursor& cursor, size_t bytes) {
+        if (cursor.capacity - cursor.out < bytes) {
+            folded.resize(std::max(cursor.capacity * 2, cursor.out + bytes));
+            cursor.data = &folded[0];
+            cursor.capacity = folded.size();
+        }
+    }
+    
+    // Emits the tokens a block's mask ends and advances past the block
+    template <typename F>
+    static void foldMask(uint64_t mask, Cursor& cursor, F& f) {
+        // Set where a token starts or ends; the two alternate
+        uint64_t edges = mask ^ ((mask << 1) | static_cast<uint64_t>(cursor.in_token));
+        size_t base = cursor.out;
+        while (edges) {
+            size_t at = base + static_cast<size_t>(__builtin_ctzll(edges));
+            if (cursor.in_token) {
+                cursor.out = at;
+                cursor.emit(f);
+            } else {
+                cursor.start = at;
+                cursor.in_token = true;
+            }
+            edges &= edges - 1;
+        }
+        cursor.in += kBlockBytes;
+        cursor.out = base + kBlockBytes;
+        if (cursor.in_token) {
+            cursor.last = cursor.out - 1;
+        }
+    }
+    
+    // Folds codepoints until the input position reaches end; the last one
+    // may extend past it. The cursor is passed by value so that its
+    // address never escapes the ASCII loop.
+    //
+    // Well-formed two- and three-byte sequences are decoded inline. A
+    // two-byte codepoint is then a single lookup in twoByteTable(), and a
+    // three-byte word or ideograph that folds to itself is copied as is;
+    // everything else goes through foldCodepoint().
+    template <typename F>
+    static Cursor foldCodepoints(std::string_view text, size_t end, std::string& folded,
+                                 Cursor cursor, bool normalize, F& f) {
+        const auto& table = TextParser::table();
+        const auto& two_byte = twoByteTable();
+        const auto* in = reinterpret_cast<const uint8_t*>(text.data());
+        while (cursor.in < end) {
+            reserve(folded, cursor, kMaxCodepointBytes);
+            uint8_t c = in[cursor.in];
+            if (c < 0x80) {
+                ++cursor.in;
+                if (table.token[c]) {
+                    if (!cursor.in_token) {
+                        cursor.start = cursor.out;
+                        cursor.in_token = true;
+                    }
+                    cursor.last = cursor.out;
+                    cursor.data[cursor.out++] = static_cast<char>(table.lower[c]);
+                } else if (cursor.in_token) {
+                    cursor.emit(f);
+                }
+                continue;
+            }
             
-            std::string url = html.substr(pos, end - pos);
-            if (!url.empty() && url.find("://") != std::string::npos) {
-                links.push_back(url);
+            size_t available = text.size() - cursor.in;
+            const uint8_t* s = in + cursor.in;
+            if (c >= 0xC2 && c < 0xE0 && available >= 2 && (s[1] & 0xC0) == 0x80) {
+                uint32_t cp = (c & 0x1Fu) << 6 | (s[1] & 0x3Fu);
+                const TwoByte& entry = two_byte[cp - 0x80];
+                if (entry.cls == Unicode::Word && !(normalize && entry.mapped)) {
+                    cursor.in += 2;
+                    if (!cursor.in_token) {
+                        cursor.start = cursor.out;
+                        cursor.in_token = true;
+                    }
+                    cursor.last = cursor.out;
+                    std::memcpy(cursor.data + cursor.out, entry.bytes, sizeof(entry.bytes));
+                    cursor.out += entry.length;
+                    continue;
+                }
+            } else if ((c & 0xF0) == 0xE0 && available >= 3 &&
+                       (s[1] & 0xC0) == 0x80 && (s[2] & 0xC0) == 0x80) {
+                uint32_t cp = (c & 0x0Fu) << 12 | (s[1] & 0x3Fu) << 6 | (s[2] & 0x3Fu);
+                if (cp >= 0x800 && (cp < 0xD800 || cp > 0xDFFF)) {
+                    const auto& property = Unicode::property(cp);
+                    if (property.fold_delta == 0 && !(normalize && property.mapped) &&
+                        (property.cls == Unicode::Word || property.cls == Unicode::Ideograph)) {
+                        cursor.in += 3;
+                        if (property.cls == Unicode::Ideograph || !cursor.in_token) {
+                            if (cursor.in_token) {
+                                cursor.emit(f);
+                            }
+                            cursor.start = cursor.out;
+                            cursor.in_token = true;
+                        }
+                        cursor.last = cursor.out;
+                        std::memcpy(cursor.data + cursor.out, s, 3);
+                        cursor.out += 3;
+                        if (property.cls == Unicode::Ideograph) {
+                            cursor.emit(f);
+                        }
+                        continue;
+                    }
+                }
             }
             
-            pos = end + 1;
+            size_t length;
+            uint32_t cp = Unicode::decode(text.data() + cursor.in, available, length);
+            cursor.in += length;
+            const auto& property = Unicode::property(cp);
+            if (normalize && property.mapped) {
+                const uint32_t* begin;
+                const uint32_t* mapped_end;
+                Unicode::mapping(cp, begin, mapped_end);
+                for (const uint32_t* it = begin; it != mapped_end; ++it) {
+                    foldCodepoint(*it, Unicode::property(*it), cursor, normalize, f);
+                }
+            } else {
+                foldCodepoint(cp, property, cursor, normalize, f);
+            }
         }
+        return cursor;
+    }
+    
+    template <typename F>
+    static void foldCodepoint(uint32_t cp, const UnicodeData::Property& property,
+                              Cursor& cursor, bool normalize, F& f) {
+        switch (property.cls) {
+        case Unicode::Word:
+            if (!cursor.in_token) {
+                cursor.start = cursor.out;
+                cursor.in_token = true;
+            }
+            cursor.last = cursor.out;
+            cursor.out += Unicode::encode(cp + property.fold_delta, cursor.data + cursor.out);
+            break;
+        case Unicode::Mark:
+            // A mark outside a word is dropped like any separator
+            if (!cursor.in_token) break;
+            if (normalize && cursor.last != kNone && Unicode::composes(cp)) {
+                size_t length;
+                uint32_t starter = Unicode::decode(cursor.data + cursor.last, cursor.out - cursor.last, length);
+                if (uint32_t composed = Unicode::compose(starter, cp)) {
+                    cursor.out = cursor.last + Unicode::encode(Unicode::fold(composed), cursor.data + cursor.last);
+                    break;
+                }
+            }
+            cursor.last = kNone;
+            cursor.out += Unicode::encode(cp + property.fold_delta, cursor.data + cursor.out);
+            break;
+        case Unicode::Ideograph:
+            if (cursor.in_token) {
+                cursor.emit(f);
+            }
+            cursor.start = cursor.out;
+            cursor.out += Unicode::encode(cp, cursor.data + cursor.out);
+            cursor.emit(f);
+            break;
+        default:
+            if (cursor.in_token) {
+                cursor.emit(f);
+            }
+            break;
+        }
+    }
+    
+    static BlockMask foldBlockScalar(const char* in, char* out) {
+        const auto& table = TextParser::table();
+        uint8_t any = 0;
+        for (size_t i = 0; i < kBlockBytes; ++i) {
+            any |= static_cast<uint8_t>(in[i]);
+        }
+        if (any & 0x80) return {0, false};
         
-        return links;
+        uint64_t mask = 0;
+        for (size_t i = 0; i < kBlockBytes; ++i) {
+            uint8_t c = static_cast<uint8_t>(in[i]);
+            out[i] = static_cast<char>(table.lower[c]);
+            mask |= static_cast<uint64_t>(table.token[c]) << i;
+        }
+        return {mask, true};
+    }
+    
+#ifdef __SSE2__
+    static BlockMask foldSse2(const char* in, char* out) {
+        __m128i v[4];
+        __m128i any = _mm_setzero_si128();
+        for (int k = 0; k < 4; ++k) {
+            v[k] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 16 * k));
+            any = _mm_or_si128(any, v[k]);
+        }
+        if (_mm_movemask_epi8(any)) return {0, false};
+        
+        const __m128i upper_lo = _mm_set1_epi8('A' - 1), upper_hi = _mm_set1_epi8('Z' + 1);
+        const __m128i lower_lo = _mm_set1_epi8('a' - 1), lower_hi = _mm_set1_epi8('z' + 1);
+        const __m128i digit_lo = _mm_set1_epi8('0' - 1), digit_hi = _mm_set1_epi8('9' + 1);
+        const __m128i case_bit = _mm_set1_epi8(0x20), apostrophe = _mm_set1_epi8('\'');
+        
+        uint64_t mask = 0;
+        for (int k = 0; k < 4; ++k) {
+            __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(v[k], upper_lo), _mm_cmpgt_epi8(upper_hi, v[k]));
+            __m128i lower = _mm_or_si128(v[k], _mm_and_si128(upper, case_bit));
+            __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(lower, lower_lo), _mm_cmpgt_epi8(lower_hi, lower));
+            __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(v[k], digit_lo), _mm_cmpgt_epi8(digit_hi, v[k]));
+            __m128i token = _mm_or_si128(_mm_or_si128(letter, digit), _mm_cmpeq_epi8(v[k], apostrophe));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 16 * k), lower);
+            mask |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(token))) << (16 * k);
+        }
+        return {mask, true};
+    }
+#endif
+    
+#if defined(__x86_64__) || defined(__i386__)
+    __attribute__((target("avx2")))
+    static BlockMask foldAvx2(const char* in, char* out) {
+        __m256i v[2];
+        v[0] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in));
+        v[1] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + 32));
+        if (_mm256_movemask_epi8(_mm256_or_si256(v[0], v[1]))) return {0, false};
+        
+        const __m256i upper_lo = _mm256_set1_epi8('A' - 1), upper_hi = _mm256_set1_epi8('Z' + 1);
+        const __m256i lower_lo = _mm256_set1_epi8('a' - 1), lower_hi = _mm256_set1_epi8('z' + 1);
+        const __m256i digit_lo = _mm256_set1_epi8('0' - 1), digit_hi = _mm256_set1_epi8('9' + 1);
+        const __m256i case_bit = _mm256_set1_epi8(0x20), apostrophe = _mm256_set1_epi8('\'');
+        
+        uint64_t mask = 0;
+        for (int k = 0; k < 2; ++k) {
+            __m256i upper = _mm256_and_si256(_mm256_cmpgt_epi8(v[k], upper_lo), _mm256_cmpgt_epi8(upper_hi, v[k]));
+            __m256i lower = _mm256_or_si256(v[k], _mm256_and_si256(upper, case_bit));
+            __m256i letter = _mm256_and_si256(_mm256_cmpgt_epi8(lower, lower_lo), _mm256_cmpgt_epi8(lower_hi, lower));
+            __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(v[k], digit_lo), _mm256_cmpgt_epi8(digit_hi, v[k]));
+            __m256i token = _mm256_or_si256(_mm256_or_si256(letter, digit), _mm256_cmpeq_epi8(v[k], apostrophe));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 32 * k), lower);
+            mask |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(token))) << (32 * k);
+        }
+        return {mask, true};
+    }
+#endif
+    
+    static BlockFolder blockFolder() {
+        static const BlockFolder folder = [] {
+#if defined(__x86_64__) || defined(__i386__)
+            if (__builtin_cpu_supports("avx2")) return static_cast<BlockFolder>(&foldAvx2);
+#endif
+#ifdef __SSE2__
+            return static_cast<BlockFolder>(&foldSse2);
+#else
+            return static_cast<BlockFolder>(&foldBlockScalar);
+#endif
+        }();
+        return folder;
+    }
+    
+    struct CharTable {
+        std::array<uint8_t, 256> token{};
+        std::array<uint8_t, 256> lower{};
+        
+        constexpr CharTable() {
+            for (int c = 0; c < 256; ++c) {
+                bool upper = c >= 'A' && c <= 'Z';
+                bool alnum = upper || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9');
+                token[c] = alnum || c == '\'';
+                lower[c] = static_cast<uint8_t>(upper ? c + ('a' - 'A') : c);
+            }
+        }
+    };
+    
+    static const CharTable& table() {
+        static constexpr CharTable kTable{};
+        return kTable;
+    }
+    
+    // Class and folded encoding of U+0080..U+07FF, the two-byte range
+    // that holds Latin, Greek, Cyrillic, Hebrew and Arabic letters
+    struct TwoByte {
+        uint8_t cls;
+        bool mapped;
+        uint8_t length;
+        char bytes[3];
+    };
+    
+    static const std::array<TwoByte, 0x780>& twoByteTable() {
+        static const std::array<TwoByte, 0x780> kTable = [] {
+            std::array<TwoByte, 0x780> entries{};
+            for (uint32_t cp = 0x80; cp < 0x800; ++cp) {
+                const auto& property = Unicode::property(cp);
+                auto& entry = entries[cp - 0x80];
+                entry.cls = property.cls;
+                entry.mapped = property.mapped;
+                entry.length = static_cast<uint8_t>(Unicode::encode(Unicode::fold(cp), entry.bytes));
+            }
+            return entries;
+        }();
+        return kTable;
     }
 }; 
\ No newline at end of file
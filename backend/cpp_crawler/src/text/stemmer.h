@@ -1,11 +1,353 @@
 #pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
 #include <string>
+#include <string_view>
 
+// Porter2 stemmer, following the Snowball 3 English rules. A word is stemmed in place in a
+// small buffer, matching suffixes against per-step tables ordered
+// longest first, so stemming a token allocates nothing. Term frequency
+// is Zipfian, so most calls can go through stemCached(), which keeps a
+// bounded per-thread memo of recent words.
+//
+// Input is a case-folded token. Words of ASCII letters and apostrophes
+// are stemmed; anything else (digits, other scripts) is returned as it
+// is, as are words longer than kMaxWordBytes.
 class Stemmer {
 public:
-    static std::string stem(const std::string& word);
-    
+    static constexpr size_t kMaxWordBytes = 64;
+
+    static std::string stem(const std::string& word) {
+        char buffer[kMaxWordBytes];
+        return std::string(stem(word, buffer));
+    }
+
+    // The stem of word, viewing either word itself or buffer, which must
+    // hold kMaxWordBytes
+    static std::string_view stem(std::string_view word, char* buffer) {
+        if (word.size() <= 2 || word.size() > kMaxWordBytes) return word;
+        for (char c : word) {
+            if ((c < 'a' || c > 'z') && c != '\'') return word;
+        }
+        std::memcpy(buffer, word.data(), word.size());
+        Word w{buffer, word.size()};
+        return {buffer, stemWord(w)};
+    }
+
+    // stem() through a direct-mapped per-thread cache of kCacheEntries
+    // words. The view is valid until the next call on the same thread.
+    static std::string_view stemCached(std::string_view word) {
+        if (word.size() <= 2 || word.size() > kCachedBytes) {
+            thread_local char buffer[kMaxWordBytes];
+            return stem(word, buffer);
+        }
+        thread_local std::unique_ptr<CacheEntry[]> cache(new CacheEntry[kCacheEntries]);
+        CacheEntry& entry = cache[hash(word) & (kCacheEntries - 1)];
+        if (entry.word_length != word.size() || std::memcmp(entry.word, word.data(), word.size()) != 0) {
+            // Stems are never longer than their words
+            std::string_view stemmed = stem(word, entry.stem);
+            if (stemmed.data() == word.data()) std::memcpy(entry.stem, word.data(), word.size());
+            std::memcpy(entry.word, word.data(), word.size());
+            entry.word_length = static_cast<uint8_t>(word.size());
+            entry.stem_length = static_cast<uint8_t>(stemmed.size());
+        }
+        return {entry.stem, entry.stem_length};
+    }
+
 private:
-    static bool endsWith(std::string const &value, std::string const &ending);
-    static void replaceEnd(std::string &word, const std::string &oldEnd, const std::string &newEnd);
-}; 
\ No newline at end of file
+    static constexpr size_t kCachedBytes = 30;
+    static constexpr size_t kCacheEntries = 4096;  // 256 KB per thread
+
+    struct CacheEntry {
+        uint8_t word_length = 0;
+        uint8_t stem_length = 0;
+        char word[kCachedBytes];
+        char stem[kMaxWordBytes - kCachedBytes - 2];
+    };
+    static_assert(sizeof(CacheEntry::stem) >= kCachedBytes, "a cached stem must fit its entry");
+
+    struct Rule {
+        std::string_view suffix;
+        std::string_view replacement;
+    };
+
+    // The word being stemmed, with its R1 and R2 regions: the part after
+    // the first non-vowel following a vowel, and the same within R1
+    struct Word {
+        char* data;
+        size_t size;
+        size_t r1 = 0;
+        size_t r2 = 0;
+
+        std::string_view view() const { return {data, size}; }
+
+        bool endsWith(std::string_view suffix) const {
+            return size >= suffix.size() &&
+                   std::memcmp(data + size - suffix.size(), suffix.data(), suffix.size()) == 0;
+        }
+
+        // Replaces the last `length` bytes; never grows the word past
+        // kMaxWordBytes since replacements are shorter than suffixes
+        // except for "e" appended to a shortened word
+        void replaceEnd(size_t length, std::string_view replacement) {
+            size -= length;
+            std::memcpy(data + size, replacement.data(), replacement.size());
+            size += replacement.size();
+        }
+    };
+
+    static uint64_t hash(std::string_view word) {
+        uint64_t h = 1469598103934665603ull;
+        for (char c : word) {
+            h = (h ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+        }
+        return h ^ (h >> 32);
+    }
+
+    // 'Y' marks a y that acts as a consonant
+    static bool isVowel(char c) {
+        return c == 'a' || c == 'e' || c == 'i' || c == 'o' || c == 'u' || c == 'y';
+    }
+
+    static bool isDouble(const Word& w) {
+        if (w.size < 2 || w.data[w.size - 1] != w.data[w.size - 2]) return false;
+        switch (w.data[w.size - 1]) {
+            case 'b': case 'd': case 'f': case 'g': case 'm': case 'n': case 'p': case 'r': case 't':
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    static bool isLiEnding(char c) {
+        return c == 'c' || c == 'd' || c == 'e' || c == 'g' || c == 'h' || c == 'k' ||
+               c == 'm' || c == 'n' || c == 'r' || c == 't';
+    }
+
+    // Whether data[0, end) ends in a short syllable: non-vowel, vowel,
+    // non-vowel other than w, x or Y; vowel, non-vowel at the start; or
+    // "past"
+    static bool endsShortSyllable(const Word& w, size_t end) {
+        const char* d = w.data;
+        if (end == 2) return isVowel(d[0]) && !isVowel(d[1]);
+        if (end < 3) return false;
+        char last = d[end - 1];
+        if (!isVowel(d[end - 3]) && isVowel(d[end - 2]) && !isVowel(last) &&
+            last != 'w' && last != 'x' && last != 'Y') {
+            return true;
+        }
+        return end >= 4 && std::memcmp(d + end - 4, "past", 4) == 0;
+    }
+
+    static bool hasVowel(const Word& w, size_t end) {
+        for (size_t i = 0; i < end; ++i) {
+            if (isVowel(w.data[i])) return true;
+        }
+        return false;
+    }
+
+    // Position after the first non-vowel that follows a vowel at or
+    // after `from`
+    static size_t region(const Word& w, size_t from) {
+        for (size_t i = from + 1; i < w.size; ++i) {
+            if (isVowel(w.data[i - 1]) && !isVowel(w.data[i])) return i + 1;
+        }
+        return w.size;
+    }
+
+    // The longest rule whose suffix ends the word, or nullptr; tables
+    // list suffixes longest first. Most rules fail on the last letter.
+    template <size_t N>
+    static const Rule* longest(const Word& w, const Rule (&rules)[N]) {
+        char last = w.size ? w.data[w.size - 1] : 0;
+        for (const Rule& rule : rules) {
+            if (rule.suffix.back() == last && w.endsWith(rule.suffix)) return &rule;
+        }
+        return nullptr;
+    }
+
+    static size_t stemWord(Word& w) {
+        if (exception1(w)) return w.size;
+
+        if (w.data[0] == '\'') std::memmove(w.data, w.data + 1, --w.size);
+        // A y at the start or after a vowel is a consonant
+        for (size_t i = 0; i < w.size; ++i) {
+            if (w.data[i] == 'y' && (i == 0 || isVowel(w.data[i - 1]))) w.data[i] = 'Y';
+        }
+
+        static constexpr std::string_view kR1Prefixes[] = {
+            "arsen", "commun", "emerg", "gener", "inter", "later", "organ", "past", "univers"
+        };
+        w.r1 = 0;
+        for (std::string_view prefix : kR1Prefixes) {
+            if (w.view().substr(0, prefix.size()) == prefix) w.r1 = prefix.size();
+        }
+        if (w.r1 == 0) w.r1 = region(w, 0);
+        w.r2 = region(w, w.r1);
+
+        step0(w);
+        step1a(w);
+        step1b(w);
+        step1c(w);
+        step2(w);
+        step3(w);
+        step4(w);
+        step5(w);
+        return restoreY(w);
+    }
+
+    static size_t restoreY(Word& w) {
+        for (size_t i = 0; i < w.size; ++i) {
+            if (w.data[i] == 'Y') w.data[i] = 'y';
+        }
+        return w.size;
+    }
+
+    // Irregular forms and words the rules would overstem
+    static bool exception1(Word& w) {
+        static constexpr Rule kExceptions[] = {
+            {"skis", "ski"}, {"skies", "sky"}, {"idly", "idl"}, {"gently", "gentl"}, {"ugly", "ugli"},
+            {"early", "earli"}, {"only", "onli"}, {"singly", "singl"}, {"sky", "sky"},
+            {"news", "news"}, {"howe", "howe"}, {"atlas", "atlas"}, {"cosmos", "cosmos"},
+            {"bias", "bias"}, {"andes", "andes"},
+        };
+        for (const Rule& rule : kExceptions) {
+            if (w.view() == rule.suffix) {
+                w.replaceEnd(w.size, rule.replacement);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static void step0(Word& w) {
+        static constexpr Rule kRules[] = {{"'s'", ""}, {"'s", ""}, {"'", ""}};
+        if (const Rule* rule = longest(w, kRules)) w.replaceEnd(rule->suffix.size(), "");
+    }
+
+    static void step1a(Word& w) {
+        if (w.endsWith("sses")) {
+            w.replaceEnd(4, "ss");
+        } else if (w.endsWith("ied") || w.endsWith("ies")) {
+            // ties -> tie, cries -> cri
+            w.replaceEnd(3, w.size > 4 ? "i" : "ie");
+        } else if (w.endsWith("us") || w.endsWith("ss")) {
+            return;
+        } else if (w.endsWith("s")) {
+            // Delete if a vowel comes before the letter preceding the s:
+            // gaps -> gap, but gas and this stay
+            if (w.size >= 3 && hasVowel(w, w.size - 2)) w.replaceEnd(1, "");
+        }
+    }
+
+    static void step1b(Word& w) {
+        static constexpr Rule kRules[] = {
+            {"eedly", "ee"}, {"ingly", ""}, {"edly", ""}, {"eed", "ee"}, {"ing", ""}, {"ed", ""},
+        };
+        const Rule* rule = longest(w, kRules);
+        if (!rule) return;
+        size_t length = rule->suffix.size();
+        size_t start = w.size - length;
+        std::string_view stem(w.data, start);
+        if (!rule->replacement.empty()) {
+            // succeed, proceed and exceed keep their ending
+            if (start >= w.r1 && stem != "succ" && stem != "proc" && stem != "exc") {
+                w.replaceEnd(length, rule->replacement);
+            }
+            return;
+        }
+        if (length == 3 && rule->suffix[0] == 'i') {
+            // dying -> die, but inning, outing and evening stay
+            if (start == 2 && w.data[1] == 'y' && !isVowel(w.data[0])) {
+                w.replaceEnd(length + 1, "ie");
+                return;
+            }
+            static constexpr std::string_view kInvariant[] = {"even", "cann", "inn", "earr", "herr", "out"};
+            for (std::string_view word : kInvariant) {
+                if (stem == word) return;
+            }
+        }
+        if (!hasVowel(w, start)) return;
+        w.replaceEnd(length, "");
+        if (w.endsWith("at") || w.endsWith("bl") || w.endsWith("iz")) {
+            w.replaceEnd(0, "e");
+        } else if (isDouble(w)) {
+            // add, egg and off keep their double
+            char first = w.data[0];
+            if (w.size != 3 || (first != 'a' && first != 'e' && first != 'o')) w.size--;
+        } else if (w.r1 == w.size && endsShortSyllable(w, w.size)) {
+            w.replaceEnd(0, "e");
+        }
+    }
+
+    static void step1c(Word& w) {
+        if (w.size <= 2) return;
+        char& last = w.data[w.size - 1];
+        if ((last == 'y' || last == 'Y') && !isVowel(w.data[w.size - 2])) last = 'i';
+    }
+
+    static void step2(Word& w) {
+        static constexpr Rule kRules[] = {
+            {"ization", "ize"}, {"ational", "ate"}, {"fulness", "ful"}, {"ousness", "ous"},
+            {"iveness", "ive"}, {"tional", "tion"}, {"biliti", "ble"}, {"lessli", "less"},
+            {"ogist", "og"}, {"entli", "ent"}, {"ation", "ate"}, {"alism", "al"}, {"aliti", "al"},
+            {"ousli", "ous"}, {"iviti", "ive"}, {"fulli", "ful"}, {"enci", "ence"},
+            {"anci", "ance"}, {"abli", "able"}, {"izer", "ize"}, {"ator", "ate"},
+            {"alli", "al"}, {"bli", "ble"}, {"ogi", "og"}, {"li", ""},
+        };
+        const Rule* rule = longest(w, kRules);
+        if (!rule) return;
+        size_t length = rule->suffix.size();
+        size_t start = w.size - length;
+        if (start < w.r1) return;
+        if (rule->suffix == "ogi" && (start == 0 || w.data[start - 1] != 'l')) return;
+        if (rule->suffix == "li" && (start == 0 || !isLiEnding(w.data[start - 1]))) return;
+        w.replaceEnd(length, rule->replacement);
+    }
+
+    static void step3(Word& w) {
+        static constexpr Rule kRules[] = {
+            {"ational", "ate"}, {"tional", "tion"}, {"alize", "al"}, {"icate", "ic"},
+            {"iciti", "ic"}, {"ative", ""}, {"ical", "ic"}, {"ness", ""}, {"ful", ""},
+        };
+        const Rule* rule = longest(w, kRules);
+        if (!rule) return;
+        size_t length = rule->suffix.size();
+        size_t start = w.size - length;
+        if (start < w.r1) return;
+        if (rule->suffix == "ative" && start < w.r2) return;
+        w.replaceEnd(length, rule->replacement);
+    }
+
+    static void step4(Word& w) {
+        static constexpr Rule kRules[] = {
+            {"ement", ""}, {"ance", ""}, {"ence", ""}, {"able", ""}, {"ible", ""}, {"ment", ""},
+            {"ant", ""}, {"ent", ""}, {"ism", ""}, {"ate", ""}, {"iti", ""}, {"ous", ""},
+            {"ive", ""}, {"ize", ""}, {"ion", ""}, {"al", ""}, {"er", ""}, {"ic", ""},
+        };
+        const Rule* rule = longest(w, kRules);
+        if (!rule) return;
+        size_t length = rule->suffix.size();
+        size_t start = w.size - length;
+        if (start < w.r2) return;
+        if (rule->suffix == "ion" &&
+            (start == 0 || (w.data[start - 1] != 's' && w.data[start - 1] != 't'))) {
+            return;
+        }
+        w.replaceEnd(length, "");
+    }
+
+    static void step5(Word& w) {
+        if (w.size == 0) return;
+        size_t start = w.size - 1;
+        char last = w.data[start];
+        if (last == 'e') {
+            if (start >= w.r2 || (start >= w.r1 && !endsShortSyllable(w, start))) w.size--;
+        } else if (last == 'l') {
+            if (start >= w.r2 && start > 0 && w.data[start - 1] == 'l') w.size--;
+        }
+    }
+};
@@ -1,10 +1,231 @@
 #pragma once
-#include <unordered_set>
 
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string_view>
+
+// Stopword lists compiled into perfect-hash tables. Each table is built
+// by a constexpr constructor, so it sits in read-only data with no static
+// initialization, and a lookup is a length check, one hash and at most one
+// comparison, cheap enough to run on every token as it is emitted.
+//
+// Words are matched as forEachToken() emits them: case folded UTF-8, with
+// typographic apostrophes already folded to '.
 class StopWords {
 public:
-    static bool isStopWord(const std::string& word);
-    
+    enum class Language { English, French, German, Spanish };
+
+    static bool isStopWord(std::string_view word, Language language = Language::English) {
+        switch (language) {
+            case Language::English: return english().contains(word);
+            case Language::French: return french().contains(word);
+            case Language::German: return german().contains(word);
+            case Language::Spanish: return spanish().contains(word);
+        }
+        return false;
+    }
+
 private:
-    static const std::unordered_set<std::string> STOP_WORDS;
-}; 
\ No newline at end of file
+    // Hash and displace: words are grouped into buckets by hash, and each
+    // bucket, largest first, gets the first seed that moves all of its
+    // words into free slots. A set that cannot be built (duplicate words)
+    // fails to compile.
+    template <size_t N>
+    class PerfectHashSet {
+    public:
+        constexpr explicit PerfectHashSet(const std::string_view (&words)[N]) {
+            uint64_t hashes[N] = {};
+            size_t bucket_start[kBuckets + 1] = {};
+            for (size_t i = 0; i < N; ++i) {
+                for (size_t j = 0; j < i; ++j) {
+                    if (words[i] == words[j]) throw std::logic_error("duplicate stopword");
+                }
+                if (words[i].empty()) throw std::logic_error("empty stopword");
+                hashes[i] = hash(words[i]);
+                bucket_start[hashes[i] % kBuckets + 1]++;
+                if (i == 0 || words[i].size() < min_length_) min_length_ = words[i].size();
+                if (words[i].size() > max_length_) max_length_ = words[i].size();
+            }
+
+            // Word indices grouped by bucket
+            for (size_t b = 0; b < kBuckets; ++b) bucket_start[b + 1] += bucket_start[b];
+            size_t members[N] = {};
+            size_t filled[kBuckets] = {};
+            for (size_t i = 0; i < N; ++i) {
+                size_t b = hashes[i] % kBuckets;
+                members[bucket_start[b] + filled[b]++] = i;
+            }
+
+            size_t order[kBuckets] = {};
+            for (size_t b = 0; b < kBuckets; ++b) {
+                size_t k = b;
+                for (; k > 0 && filled[order[k - 1]] < filled[b]; --k) order[k] = order[k - 1];
+                order[k] = b;
+            }
+
+            bool used[kSlots] = {};
+            for (size_t b : order) {
+                size_t count = filled[b];
+                if (count == 0) break;
+                const size_t* bucket = members + bucket_start[b];
+                for (uint32_t seed = 0;; ++seed) {
+                    if (seed > UINT16_MAX) throw std::logic_error("no perfect hash seed");
+                    size_t placed[N] = {};
+                    bool fits = true;
+                    for (size_t k = 0; k < count && fits; ++k) {
+                        placed[k] = slot(hashes[bucket[k]], seed);
+                        fits = !used[placed[k]];
+                        for (size_t m = 0; m < k && fits; ++m) fits = placed[m] != placed[k];
+                    }
+                    if (!fits) continue;
+                    for (size_t k = 0; k < count; ++k) {
+                        used[placed[k]] = true;
+                        slots_[placed[k]] = words[bucket[k]];
+                    }
+                    seeds_[b] = static_cast<uint16_t>(seed);
+                    break;
+                }
+            }
+        }
+
+        constexpr bool contains(std::string_view word) const {
+            if (word.size() < min_length_ || word.size() > max_length_) return false;
+            uint64_t h = hash(word);
+            return slots_[slot(h, seeds_[h % kBuckets])] == word;
+        }
+
+    private:
+        // Moduli are compile-time constants, so the divisions become
+        // multiplies
+        static constexpr size_t kSlots = N + N / 4 + 1;
+        static constexpr size_t kBuckets = N / 4 + 1;
+
+        std::string_view slots_[kSlots] = {};
+        uint16_t seeds_[kBuckets] = {};
+        size_t min_length_ = 0;
+        size_t max_length_ = 0;
+
+        static constexpr uint64_t hash(std::string_view word) {
+            uint64_t h = 1469598103934665603ull;
+            for (char c : word) {
+                h = (h ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+            }
+            return h;
+        }
+
+        static constexpr size_t slot(uint64_t h, uint32_t seed) {
+            uint64_t x = (h >> 16) ^ (seed * 0x9e3779b97f4a7c15ull);
+            x = (x ^ (x >> 31)) * 0xbf58476d1ce4e5b9ull;
+            return (x ^ (x >> 29)) % kSlots;
+        }
+    };
+
+    // From the Snowball stop lists; Spanish keeps the common verb forms only
+    static constexpr std::string_view kEnglish[] = {
+        "i", "me", "my", "myself", "we", "our", "ours", "ourselves", "you", "your", "yours",
+        "yourself", "yourselves", "he", "him", "his", "himself", "she", "her", "hers", "herself",
+        "it", "its", "itself", "they", "them", "their", "theirs", "themselves", "what", "which",
+        "who", "whom", "this", "that", "these", "those", "am", "is", "are", "was", "were", "be",
+        "been", "being", "have", "has", "had", "having", "do", "does", "did", "doing", "would",
+        "should", "could", "ought", "i'm", "you're", "he's", "she's", "it's", "we're", "they're",
+        "i've", "you've", "we've", "they've", "i'd", "you'd", "he'd", "she'd", "we'd", "they'd",
+        "i'll", "you'll", "he'll", "she'll", "we'll", "they'll", "isn't", "aren't", "wasn't",
+        "weren't", "hasn't", "haven't", "hadn't", "doesn't", "don't", "didn't", "won't",
+        "wouldn't", "shan't", "shouldn't", "can't", "cannot", "couldn't", "mustn't", "let's",
+        "that's", "who's", "what's", "here's", "there's", "when's", "where's", "why's", "how's",
+        "a", "an", "the", "and", "but", "if", "or", "because", "as", "until", "while", "of",
+        "at", "by", "for", "with", "about", "against", "between", "into", "through", "during",
+        "before", "after", "above", "below", "to", "from", "up", "down", "in", "out", "on",
+        "off", "over", "under", "again", "further", "then", "once", "here", "there", "when",
+        "where", "why", "how", "all", "any", "both", "each", "few", "more", "most", "other",
+        "some", "such", "no", "nor", "not", "only", "own", "same", "so", "than", "too", "very",
+    };
+
+    static constexpr std::string_view kFrench[] = {
+        "au", "aux", "avec", "ce", "ces", "dans", "de", "des", "du", "elle", "en", "et", "eux",
+        "il", "je", "la", "le", "leur", "lui", "ma", "mais", "me", "même", "mes", "moi", "mon",
+        "ne", "nos", "notre", "nous", "on", "ou", "par", "pas", "pour", "qu", "que", "qui", "sa",
+        "se", "ses", "son", "sur", "ta", "te", "tes", "toi", "ton", "tu", "un", "une", "vos",
+        "votre", "vous", "c", "d", "j", "l", "à", "m", "n", "s", "t", "y", "été", "étée",
+        "étées", "étés", "étant", "suis", "es", "est", "sommes", "êtes", "sont", "serai",
+        "seras", "sera", "serons", "serez", "seront", "serais", "serait", "serions", "seriez",
+        "seraient", "étais", "était", "étions", "étiez", "étaient", "fus", "fut", "fûmes",
+        "fûtes", "furent", "sois", "soit", "soyons", "soyez", "soient", "fusse", "fusses", "fût",
+        "fussions", "fussiez", "fussent", "ayant", "eu", "eue", "eues", "eus", "ai", "as",
+        "avons", "avez", "ont", "aurai", "auras", "aura", "aurons", "aurez", "auront", "aurais",
+        "aurait", "aurions", "auriez", "auraient", "avais", "avait", "avions", "aviez",
+        "avaient", "eut", "eûmes", "eûtes", "eurent", "aie", "aies", "ait", "ayons", "ayez",
+        "aient", "eusse", "eusses", "eût", "eussions", "eussiez", "eussent", "ceci", "cela",
+        "cet", "cette", "ici", "ils", "les", "leurs", "quel", "quels", "quelle", "quelles",
+        "sans", "soi",
+    };
+
+    static constexpr std::string_view kGerman[] = {
+        "aber", "alle", "allem", "allen", "aller", "alles", "als", "also", "am", "an", "ander",
+        "andere", "anderem", "anderen", "anderer", "anderes", "anderm", "andern", "anderr",
+        "anders", "auch", "auf", "aus", "bei", "bin", "bis", "bist", "da", "damit", "dann",
+        "der", "den", "des", "dem", "die", "das", "dass", "daß", "derselbe", "derselben",
+        "denselben", "desselben", "demselben", "dieselbe", "dieselben", "dasselbe", "dazu",
+        "dein", "deine", "deinem", "deinen", "deiner", "deines", "denn", "derer", "dessen",
+        "dich", "dir", "du", "dies", "diese", "diesem", "diesen", "dieser", "dieses", "doch",
+        "dort", "durch", "ein", "eine", "einem", "einen", "einer", "eines", "einig", "einige",
+        "einigem", "einigen", "einiger", "einiges", "einmal", "er", "ihn", "ihm", "es", "etwas",
+        "euer", "eure", "eurem", "euren", "eurer", "eures", "für", "gegen", "gewesen", "hab",
+        "habe", "haben", "hat", "hatte", "hatten", "hier", "hin", "hinter", "ich", "mich", "mir",
+        "ihr", "ihre", "ihrem", "ihren", "ihrer", "ihres", "euch", "im", "in", "indem", "ins",
+        "ist", "jede", "jedem", "jeden", "jeder", "jedes", "jene", "jenem", "jenen", "jener",
+        "jenes", "jetzt", "kann", "kein", "keine", "keinem", "keinen", "keiner", "keines",
+        "können", "könnte", "machen", "man", "manche", "manchem", "manchen", "mancher",
+        "manches", "mein", "meine", "meinem", "meinen", "meiner", "meines", "mit", "muss",
+        "musste", "nach", "nicht", "nichts", "noch", "nun", "nur", "ob", "oder", "ohne", "sehr",
+        "sein", "seine", "seinem", "seinen", "seiner", "seines", "selbst", "sich", "sie",
+        "ihnen", "sind", "so", "solche", "solchem", "solchen", "solcher", "solches", "soll",
+        "sollte", "sondern", "sonst", "über", "um", "und", "uns", "unsere", "unserem",
+        "unseren", "unser", "unseres", "unter", "viel", "vom", "von", "vor", "während", "war",
+        "waren", "warst", "was", "weg", "weil", "weiter", "welche", "welchem", "welchen",
+        "welcher", "welches", "wenn", "werde", "werden", "wie", "wieder", "will", "wir", "wird",
+        "wirst", "wo", "wollen", "wollte", "würde", "würden", "zu", "zum", "zur", "zwar",
+        "zwischen",
+    };
+
+    static constexpr std::string_view kSpanish[] = {
+        "de", "la", "que", "el", "en", "y", "a", "los", "del", "se", "las", "por", "un", "para",
+        "con", "no", "una", "su", "al", "lo", "como", "más", "pero", "sus", "le", "ya", "o",
+        "este", "sí", "porque", "esta", "entre", "cuando", "muy", "sin", "sobre", "también",
+        "me", "hasta", "hay", "donde", "quien", "desde", "todo", "nos", "durante", "todos",
+        "uno", "les", "ni", "contra", "otros", "ese", "eso", "ante", "ellos", "e", "esto", "mí",
+        "antes", "algunos", "qué", "unos", "yo", "otro", "otras", "otra", "él", "tanto", "esa",
+        "estos", "mucho", "quienes", "nada", "muchos", "cual", "poco", "ella", "estar", "estas",
+        "algunas", "algo", "nosotros", "mi", "mis", "tú", "te", "ti", "tu", "tus", "ellas",
+        "nosotras", "vosotros", "vosotras", "os", "mío", "mía", "míos", "mías", "tuyo", "tuya",
+        "tuyos", "tuyas", "suyo", "suya", "suyos", "suyas", "nuestro", "nuestra", "nuestros",
+        "nuestras", "vuestro", "vuestra", "vuestros", "vuestras", "esos", "esas", "estoy",
+        "estás", "está", "estamos", "estáis", "están", "esté", "estés", "estemos", "estéis",
+        "estén", "estaba", "estabas", "estábamos", "estaban", "estuvo", "estuvieron", "he",
+        "has", "ha", "hemos", "habéis", "han", "haya", "hayan", "había", "habían", "hubo",
+        "soy", "eres", "es", "somos", "sois", "son", "sea", "sean", "era", "eras", "éramos",
+        "eran", "fue", "fueron", "fui", "tengo", "tiene", "tenemos", "tienen", "tenía",
+    };
+
+    static const PerfectHashSet<std::size(kEnglish)>& english() {
+        static constexpr PerfectHashSet<std::size(kEnglish)> kSet(kEnglish);
+        return kSet;
+    }
+
+    static const PerfectHashSet<std::size(kFrench)>& french() {
+        static constexpr PerfectHashSet<std::size(kFrench)> kSet(kFrench);
+        return kSet;
+    }
+
+    static const PerfectHashSet<std::size(kGerman)>& german() {
+        static constexpr PerfectHashSet<std::size(kGerman)> kSet(kGerman);
+        return kSet;
+    }
+
+    static const PerfectHashSet<std::size(kSpanish)>& spanish() {
+        static constexpr PerfectHashSet<std::size(kSpanish)> kSet(kSpanish);
+        return kSet;
+    }
+};
@@ -0,0 +1,290 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string_view>
+
+// Process-wide term -> 32-bit id map, so postings, documents and queries
+// carry integers and a term's bytes are hashed once, when it is analyzed.
+//
+// Lookups and inserts are lock-free. Terms live in a hash trie: a large
+// root array indexed by the low hash bits, then 64-slot nodes indexed by
+// the following ones. A slot is empty, a leaf (id plus a 31-bit hash tag,
+// low bit set) or a child node pointer, and each is filled by one CAS, so
+// the trie grows without ever being resized. A new term gets its id and
+// stored bytes before its leaf is published; two threads racing to add
+// the same term both agree on the winner's id, and the loser's id stays
+// unused. Term bytes are bump-allocated from shared 1 MB blocks.
+//
+// Nothing is ever removed, so ids are stable for the process lifetime and
+// the dictionary grows with every distinct term the process analyzes:
+// about 40 bytes plus the term's own per id. Ids are 32-bit; once
+// 2^32 - 1 have been handed out, intern() returns kNoTerm, which indexes
+// skip, and full() turns true. Rather than index documents with terms
+// silently dropped, BulkIndexer then fails the build and IndexManager
+// refuses further writes. Ids are not persisted: segments and the WAL
+// store term bytes.
+class TermDictionary {
+public:
+    static constexpr uint32_t kNoTerm = UINT32_MAX;
+
+    TermDictionary()
+        : root_(std::make_unique<std::atomic<uint64_t>[]>(kRootSlots)),
+          chunks_(std::make_unique<std::atomic<Entry*>[]>(kMaxChunks)) {}
+
+    TermDictionary(const TermDictionary&) = delete;
+    TermDictionary& operator=(const TermDictionary&) = delete;
+
+    ~TermDictionary() {
+        for (size_t i = 0; i < kRootSlots; ++i) {
+            freeSlot(root_[i].load(std::memory_order_relaxed));
+        }
+        for (size_t chunk = 0; chunk < kMaxChunks; ++chunk) {
+            delete[] chunks_[chunk].load(std::memory_order_relaxed);
+        }
+        for (Block* block : {current_.load(std::memory_order_relaxed),
+                             oversized_.load(std::memory_order_relaxed)}) {
+            while (block) {
+                Block* next = block->next;
+                ::operator delete(block);
+                block = next;
+            }
+        }
+    }
+
+    // The dictionary every index and analyzer in the process shares
+    static TermDictionary& shared() {
+        static TermDictionary dictionary;
+        return dictionary;
+    }
+
+    // The term's id, assigning the next one if the term is new; kNoTerm
+    // if it is new and the dictionary is full
+    uint32_t intern(std::string_view term) {
+        uint64_t hash = hashOf(term, 0);
+        uint64_t tag = hash >> 33;
+        std::atomic<uint64_t>* slot = &root_[hash & (kRootSlots - 1)];
+        uint64_t fresh = 0;   // our leaf, once an id is allocated
+        size_t depth = 0;
+
+        for (;;) {
+            uint64_t value = slot->load(std::memory_order_acquire);
+            if (value == 0) {
+                if (!fresh) {
+                    uint32_t id = allocate(term);
+                    if (id == kNoTerm) return kNoTerm;
+                    fresh = leaf(tag, id);
+                }
+                // The release publishes the entry written by allocate()
+                if (slot->compare_exchange_strong(value, fresh, std::memory_order_acq_rel,
+                                                  std::memory_order_acquire)) {
+                    return idOf(fresh);
+                }
+                continue;
+            }
+            if (value & 1) {
+                if (matches(value, tag, term)) return idOf(value);
+
+                // Push the resident leaf one level down and retry there
+                Node* node = new Node();
+                node->slots[slotIndex(this->term(idOf(value)), depth + 1)].store(
+                    value, std::memory_order_relaxed);
+                if (!slot->compare_exchange_strong(value, reinterpret_cast<uint64_t>(node),
+                                                   std::memory_order_acq_rel,
+                                                   std::memory_order_acquire)) {
+                    delete node;
+                    continue;
+                }
+                value = reinterpret_cast<uint64_t>(node);
+            }
+            depth++;
+            slot = &reinterpret_cast<Node*>(value)->slots[slotIndex(term, hash, depth)];
+        }
+    }
+
+    // The term's id, or kNoTerm if it was never interned
+    uint32_t find(std::string_view term) const {
+        uint64_t hash = hashOf(term, 0);
+        uint64_t tag = hash >> 33;
+        uint64_t value = root_[hash & (kRootSlots - 1)].load(std::memory_order_acquire);
+        for (size_t depth = 1; value != 0; ++depth) {
+            if (value & 1) {
+                return matches(value, tag, term) ? idOf(value) : kNoTerm;
+            }
+            value = reinterpret_cast<const Node*>(value)->slots[slotIndex(term, hash, depth)]
+                        .load(std::memory_order_acquire);
+        }
+        return kNoTerm;
+    }
+
+    // Bytes of an id intern() returned; valid for the dictionary's lifetime
+    std::string_view term(uint32_t id) const {
+        const Entry* entries = chunks_[id >> kChunkBits].load(std::memory_order_acquire);
+        const Entry& entry = entries[id & (kChunkSize - 1)];
+        return {entry.data, entry.size};
+    }
+
+    // Ids handed out so far, including any left unused by a lost race
+    size_t size() const {
+        return static_cast<size_t>(std::min<uint64_t>(next_id_.load(std::memory_order_relaxed), kNoTerm));
+    }
+
+    // True once every id is taken; new terms then intern to kNoTerm
+    bool full() const {
+        return next_id_.load(std::memory_order_relaxed) >= kNoTerm;
+    }
+
+private:
+    static constexpr size_t kRootBits = 16;
+    static constexpr size_t kRootSlots = size_t(1) << kRootBits;
+    static constexpr size_t kNodeBits = 6;
+    static constexpr size_t kNodeSlots = size_t(1) << kNodeBits;
+    // Node levels served by the first hash; each later round rehashes with
+    // a new seed and serves 64 / kNodeBits levels
+    static constexpr size_t kFirstRoundLevels = (64 - kRootBits) / kNodeBits;
+    static constexpr size_t kRoundLevels = 64 / kNodeBits;
+
+    static constexpr size_t kChunkBits = 16;
+    static constexpr size_t kChunkSize = size_t(1) << kChunkBits;
+    static constexpr size_t kMaxChunks = (uint64_t(kNoTerm) + kChunkSize - 1) >> kChunkBits;
+
+    struct Node {
+        std::atomic<uint64_t> slots[kNodeSlots] = {};
+    };
+
+    struct Entry {
+        const char* data;
+        uint32_t size;
+    };
+
+    // Arena block for term bytes; data follows the header
+    struct Block {
+        Block* next;
+        size_t capacity;
+        std::atomic<size_t> used;
+        char* data() { return reinterpret_cast<char*>(this + 1); }
+    };
+
+    static constexpr size_t kBlockSize = size_t(1) << 20;
+    // Longer terms get a block of their own rather than wasting the
+    // rest of a shared one
+    static constexpr size_t kMaxSharedTerm = kBlockSize / 64;
+
+    std::unique_ptr<std::atomic<uint64_t>[]> root_;
+    // Id -> bytes, in chunks allocated on first use
+    std::unique_ptr<std::atomic<Entry*>[]> chunks_;
+    std::atomic<uint64_t> next_id_{0};
+    // Block being bump-allocated from, linked to the ones filled before it
+    std::atomic<Block*> current_{nullptr};
+    std::atomic<Block*> oversized_{nullptr};
+
+    // FNV-1a with a seeded basis, then a murmur finalizer so the low bits
+    // the trie indexes by are well mixed
+    static uint64_t hashOf(std::string_view term, uint64_t seed) {
+        uint64_t h = 14695981039346656037ull ^ (seed * 0x9e3779b97f4a7c15ull);
+        for (unsigned char c : term) {
+            h = (h ^ c) * 1099511628211ull;
+        }
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ull;
+        return h ^ (h >> 33);
+    }
+
+    // Slot of term in a node at depth >= 1, given its first-round hash
+    static size_t slotIndex(std::string_view term, uint64_t hash, size_t depth) {
+        size_t level = depth - 1;
+        if (level < kFirstRoundLevels) {
+            return (hash >> (kRootBits + level * kNodeBits)) & (kNodeSlots - 1);
+        }
+        level -= kFirstRoundLevels;
+        uint64_t rehash = hashOf(term, 1 + level / kRoundLevels);
+        return (rehash >> (level % kRoundLevels * kNodeBits)) & (kNodeSlots - 1);
+    }
+
+    static size_t slotIndex(std::string_view term, size_t depth) {
+        return slotIndex(term, hashOf(term, 0), depth);
+    }
+
+    static uint64_t leaf(uint64_t tag, uint32_t id) {
+        return (tag << 33) | (uint64_t(id) << 1) | 1;
+    }
+
+    static uint32_t idOf(uint64_t leaf) {
+        return static_cast<uint32_t>(leaf >> 1);
+    }
+
+    bool matches(uint64_t leaf, uint64_t tag, std::string_view term) const {
+        return (leaf >> 33) == tag && this->term(idOf(leaf)) == term;
+    }
+
+    uint32_t allocate(std::string_view term) {
+        uint64_t id = next_id_.fetch_add(1, std::memory_order_relaxed);
+        if (id >= kNoTerm) return kNoTerm;
+
+        std::atomic<Entry*>& chunk = chunks_[id >> kChunkBits];
+        Entry* entries = chunk.load(std::memory_order_acquire);
+        if (!entries) {
+            Entry* fresh = new Entry[kChunkSize]();
+            if (chunk.compare_exchange_strong(entries, fresh, std::memory_order_acq_rel,
+                                              std::memory_order_acquire)) {
+                entries = fresh;
+            } else {
+                delete[] fresh;
+            }
+        }
+
+        char* data = storeBytes(term);
+        entries[id & (kChunkSize - 1)] = {data, static_cast<uint32_t>(term.size())};
+        return static_cast<uint32_t>(id);
+    }
+
+    char* storeBytes(std::string_view term) {
+        if (term.size() > kMaxSharedTerm) {
+            Block* block = newBlock(term.size(), oversized_.load(std::memory_order_relaxed));
+            while (!oversized_.compare_exchange_weak(block->next, block, std::memory_order_release,
+                                                     std::memory_order_relaxed)) {}
+            std::memcpy(block->data(), term.data(), term.size());
+            return block->data();
+        }
+
+        Block* block = current_.load(std::memory_order_acquire);
+        for (;;) {
+            if (block) {
+                size_t offset = block->used.fetch_add(term.size(), std::memory_order_relaxed);
+                if (offset + term.size() <= block->capacity) {
+                    char* data = block->data() + offset;
+                    std::memcpy(data, term.data(), term.size());
+                    return data;
+                }
+            }
+            // The block is exhausted: install a fresh one, or use the one
+            // another thread installed first
+            Block* fresh = newBlock(kBlockSize, block);
+            if (current_.compare_exchange_strong(block, fresh, std::memory_order_acq_rel,
+                                                 std::memory_order_acquire)) {
+                block = fresh;
+            } else {
+                ::operator delete(fresh);
+            }
+        }
+    }
+
+    static Block* newBlock(size_t capacity, Block* next) {
+        return new (::operator new(sizeof(Block) + capacity)) Block{next, capacity, {0}};
+    }
+
+    static void freeSlot(uint64_t value) {
+        if (value == 0 || (value & 1)) return;
+        Node* node = reinterpret_cast<Node*>(value);
+        for (auto& slot : node->slots) {
+            freeSlot(slot.load(std::memory_order_relaxed));
+        }
+        delete node;
+    }
+};
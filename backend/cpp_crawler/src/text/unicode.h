@@ -0,0 +1,156 @@
+#pragma once
+
+#include "unicode_data.h"
+#include <algorithm>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+// Codepoint-level helpers for the tokenizer: UTF-8 coding and lookups in
+// the generated tables of unicode_data.h
+class Unicode {
+public:
+    // Token classes. A word is a run of Word codepoints, which Marks may
+    // extend; each Ideograph (Han, Hiragana) is a token of its own, since
+    // those scripts do not separate words with spaces.
+    enum Class : uint8_t { Other = 0, Word = 1, Mark = 2, Ideograph = 3 };
+
+    static constexpr uint32_t kReplacement = 0xFFFD;
+    static constexpr size_t kMaxEncodedBytes = 4;
+
+    // Decodes the codepoint at p, of which `available` bytes may be read.
+    // Malformed input (overlong, surrogate, truncated) yields kReplacement
+    // with length 1 so decoding resynchronizes on the next byte.
+    static uint32_t decode(const char* p, size_t available, size_t& length) {
+        const auto* s = reinterpret_cast<const uint8_t*>(p);
+        length = 1;
+        if (s[0] < 0x80) return s[0];
+
+        size_t needed;
+        uint32_t cp;
+        uint32_t min;
+        if ((s[0] & 0xE0) == 0xC0) {
+            needed = 2, cp = s[0] & 0x1F, min = 0x80;
+        } else if ((s[0] & 0xF0) == 0xE0) {
+            needed = 3, cp = s[0] & 0x0F, min = 0x800;
+        } else if ((s[0] & 0xF8) == 0xF0) {
+            needed = 4, cp = s[0] & 0x07, min = 0x10000;
+        } else {
+            return kReplacement;
+        }
+        if (available < needed) return kReplacement;
+        for (size_t i = 1; i < needed; ++i) {
+            if ((s[i] & 0xC0) != 0x80) return kReplacement;
+            cp = (cp << 6) | (s[i] & 0x3F);
+        }
+        if (cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+            return kReplacement;
+        }
+        length = needed;
+        return cp;
+    }
+
+    // Writes cp as UTF-8, returning the byte count
+    static size_t encode(uint32_t cp, char* out) {
+        if (cp < 0x80) {
+            out[0] = static_cast<char>(cp);
+            return 1;
+        }
+        if (cp < 0x800) {
+            out[0] = static_cast<char>(0xC0 | (cp >> 6));
+            out[1] = static_cast<char>(0x80 | (cp & 0x3F));
+            return 2;
+        }
+        if (cp < 0x10000) {
+            out[0] = static_cast<char>(0xE0 | (cp >> 12));
+            out[1] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out[2] = static_cast<char>(0x80 | (cp & 0x3F));
+            return 3;
+        }
+        out[0] = static_cast<char>(0xF0 | (cp >> 18));
+        out[1] = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        out[2] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out[3] = static_cast<char>(0x80 | (cp & 0x3F));
+        return 4;
+    }
+
+    static const UnicodeData::Property& property(uint32_t cp) {
+        if (cp >= UnicodeData::kLimit) return UnicodeData::kProperties[0];
+        uint32_t block = UnicodeData::kStage1[cp >> UnicodeData::kBlockBits];
+        uint32_t offset = cp & ((1u << UnicodeData::kBlockBits) - 1);
+        return UnicodeData::kProperties[UnicodeData::kStage2[(block << UnicodeData::kBlockBits) + offset]];
+    }
+
+    // Simple case folding: one codepoint to one
+    static uint32_t fold(uint32_t cp) {
+        return static_cast<uint32_t>(static_cast<int32_t>(cp) + property(cp).fold_delta);
+    }
+
+    // NFKC compatibility mapping of a codepoint whose property says it
+    // has one; stores the target codepoints in [begin, end)
+    static void mapping(uint32_t cp, const uint32_t*& begin, const uint32_t*& end) {
+        uint16_t index = cp < UnicodeData::kLimit ? mappingIndex(cp) : 0;
+        if (index == 0) {
+            begin = end = nullptr;
+            return;
+        }
+        begin = UnicodeData::kMappingTargets + UnicodeData::kMappingOffsets[index - 1];
+        end = UnicodeData::kMappingTargets + UnicodeData::kMappingOffsets[index];
+    }
+
+    // Whether cp is the second codepoint of any canonical composition;
+    // most marks are not, and need no lookup of their starter
+    static bool composes(uint32_t cp) {
+        static const std::bitset<UnicodeData::kLimit> kMarks = [] {
+            std::bitset<UnicodeData::kLimit> marks;
+            for (uint64_t key : UnicodeData::kCompositionKeys) {
+                marks.set(key & ((1u << 21) - 1));
+            }
+            return marks;
+        }();
+        return cp < UnicodeData::kLimit && kMarks[cp];
+    }
+
+    // Canonical composition of a starter and a following mark, 0 if the
+    // pair does not compose
+    static uint32_t compose(uint32_t starter, uint32_t mark) {
+        uint64_t key = (static_cast<uint64_t>(starter) << 21) | mark;
+        const uint64_t* keys = UnicodeData::kCompositionKeys;
+        const uint64_t* last = keys + std::size(UnicodeData::kCompositionKeys);
+        const uint64_t* it = std::lower_bound(keys, last, key);
+        return it != last && *it == key ? UnicodeData::kCompositions[it - keys] : 0;
+    }
+
+private:
+    // 1 + the position of cp in kMappedCodepoints, 0 if unmapped, from a
+    // two-stage table built on first use like the property table: the
+    // 128-codepoint blocks without mappings share block 0
+    static uint16_t mappingIndex(uint32_t cp) {
+        constexpr uint32_t kBlockBits = UnicodeData::kBlockBits;
+        constexpr uint32_t kBlockSize = 1u << kBlockBits;
+        struct Table {
+            std::vector<uint16_t> stage1;
+            std::vector<uint16_t> stage2;
+        };
+        static const Table kTable = [] {
+            Table table;
+            table.stage1.assign(UnicodeData::kLimit >> kBlockBits, 0);
+            table.stage2.assign(kBlockSize, 0);
+            uint16_t index = 0;
+            for (uint32_t mapped : UnicodeData::kMappedCodepoints) {
+                uint32_t block = mapped >> kBlockBits;
+                if (table.stage1[block] == 0) {
+                    table.stage1[block] = static_cast<uint16_t>(table.stage2.size() >> kBlockBits);
+                    table.stage2.resize(table.stage2.size() + kBlockSize, 0);
+                }
+                uint32_t offset = mapped & (kBlockSize - 1);
+                table.stage2[(static_cast<uint32_t>(table.stage1[block]) << kBlockBits) + offset] = ++index;
+            }
+            return table;
+        }();
+        return kTable.stage2[(static_cast<uint32_t>(kTable.stage1[cp >> kBlockBits]) << kBlockBits) +
+                             (cp & (kBlockSize - 1))];
+    }
+};
@@ -0,0 +1,43 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+// Token-bucket limiter for background writers. acquire() blocks the
+// caller until its bytes fit under the configured rate; up to one second
+// of unused budget may be spent as a burst. A rate of 0 disables it.
+class IoThrottle {
+public:
+    explicit IoThrottle(double bytes_per_second = 0) : rate_(bytes_per_second) {}
+
+    void setRate(double bytes_per_second) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        rate_ = bytes_per_second;
+    }
+
+    double rate() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return rate_;
+    }
+
+    void acquire(size_t bytes) {
+        std::chrono::steady_clock::time_point wake;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (rate_ <= 0) return;
+
+            auto now = std::chrono::steady_clock::now();
+            next_free_ = std::max(next_free_, now - std::chrono::seconds(1));
+            next_free_ += std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(bytes / rate_));
+            wake = next_free_ - std::chrono::seconds(1);
+        }
+        std::this_thread::sleep_until(wake);
+    }
+
+private:
+    mutable std::mutex mutex_;
+    double rate_;
+    std::chrono::steady_clock::time_point next_free_{};
+};
@@ -0,0 +1,63 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+// Lock-free latency recorder with power-of-two microsecond buckets.
+// Percentiles are reported as the upper bound of their bucket.
+class LatencyHistogram {
+public:
+    struct Snapshot {
+        uint64_t count;
+        double mean_ms;
+        double p50_ms;
+        double p99_ms;
+        double max_ms;
+    };
+
+    void record(std::chrono::nanoseconds latency) {
+        uint64_t ns = static_cast<uint64_t>(latency.count());
+        uint64_t us = ns / 1000;
+        size_t bucket = us == 0 ? 0 : std::min<size_t>(kBuckets - 1, 64 - __builtin_clzll(us));
+        buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+        total_ns_.fetch_add(ns, std::memory_order_relaxed);
+
+        uint64_t max = max_ns_.load(std::memory_order_relaxed);
+        while (ns > max && !max_ns_.compare_exchange_weak(max, ns, std::memory_order_relaxed)) {}
+    }
+
+    Snapshot snapshot() const {
+        std::array<uint64_t, kBuckets> counts;
+        uint64_t count = 0;
+        for (size_t i = 0; i < kBuckets; ++i) {
+            counts[i] = buckets_[i].load(std::memory_order_relaxed);
+            count += counts[i];
+        }
+
+        auto percentile = [&](double q) {
+            uint64_t rank = static_cast<uint64_t>(q * count);
+            uint64_t seen = 0;
+            for (size_t i = 0; i < kBuckets; ++i) {
+                seen += counts[i];
+                if (seen > rank) return static_cast<double>(uint64_t(1) << i) / 1000.0;
+            }
+            return 0.0;
+        };
+
+        return {
+            count,
+            count ? total_ns_.load(std::memory_order_relaxed) / 1e6 / count : 0.0,
+            count ? percentile(0.50) : 0.0,
+            count ? percentile(0.99) : 0.0,
+            max_ns_.load(std::memory_order_relaxed) / 1e6
+        };
+    }
+
+private:
+    static constexpr size_t kBuckets = 40;
+
+    std::array<std::atomic<uint64_t>, kBuckets> buckets_{};
+    std::atomic<uint64_t> total_ns_{0};
+    std::atomic<uint64_t> max_ns_{0};
+};
@@ -0,0 +1,231 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Bounded multi-producer/single-consumer ring (Vyukov's sequence-per-slot
+// scheme). The fast paths are lock-free; the mutex and condition variables
+// are only touched when a producer finds the ring full or the consumer
+// finds it empty, so an idle side can sleep instead of spinning.
+template <typename T>
+class MpscQueue {
+public:
+    enum PushMode {
+        BLOCK,  // wait for space
+        TRY,    // fail if full; the item is left with the caller
+        SHED    // drop the item if full and count it
+    };
+
+    struct Stats {
+        size_t depth;
+        size_t capacity;
+        uint64_t enqueued;
+        uint64_t rejected;
+        uint64_t dropped;
+        uint64_t stalls;
+        uint64_t stall_ns;
+    };
+
+    explicit MpscQueue(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) size <<= 1;
+        mask_ = size - 1;
+        cells_ = std::make_unique<Cell[]>(size);
+        for (size_t i = 0; i < size; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // On success the item is moved into the ring and *ticket receives its
+    // position, which totally orders all pushes. Fails once the queue is
+    // closed, whatever the mode.
+    bool push(T&& item, PushMode mode, uint64_t* ticket = nullptr) {
+        if (closed_.load(std::memory_order_acquire)) {
+            rejected_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        if (tryPush(item, ticket)) {
+            return true;
+        }
+
+        if (mode == TRY) {
+            rejected_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        if (mode == SHED) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        stalls_.fetch_add(1, std::memory_order_relaxed);
+
+        bool pushed = false;
+        while (!closed_.load(std::memory_order_acquire)) {
+            if (tryPush(item, ticket)) {
+                pushed = true;
+                break;
+            }
+            std::unique_lock<std::mutex> lock(wait_mutex_);
+            producers_waiting_.fetch_add(1, std::memory_order_seq_cst);
+            if (size() > mask_ && !closed_.load(std::memory_order_acquire)) {
+                // The timeout covers a pop racing with the registration above
+                space_cv_.wait_for(lock, std::chrono::milliseconds(1));
+            }
+            producers_waiting_.fetch_sub(1, std::memory_order_seq_cst);
+        }
+
+        stall_ns_.fetch_add(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count()), std::memory_order_relaxed);
+        if (!pushed) {
+            rejected_.fetch_add(1, std::memory_order_relaxed);
+        }
+        return pushed;
+    }
+
+    // Consumer only
+    bool tryPop(T& out) {
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        Cell& cell = cells_[pos & mask_];
+        if (cell.sequence.load(std::memory_order_acquire) != pos + 1) {
+            return false;
+        }
+
+        out = std::move(cell.value);
+        cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+        dequeue_pos_.store(pos + 1, std::memory_order_release);
+
+        if (producers_waiting_.load(std::memory_order_seq_cst) > 0) {
+            std::lock_guard<std::mutex> lock(wait_mutex_);
+            space_cv_.notify_all();
+        }
+        return true;
+    }
+
+    // Consumer only. Appends up to max items to out; returns how many.
+    size_t popBatch(std::vector<T>& out, size_t max) {
+        size_t n = 0;
+        T item;
+        while (n < max && tryPop(item)) {
+            out.push_back(std::move(item));
+            n++;
+        }
+        return n;
+    }
+
+    // Consumer only. Waits until at least min_items are queued, the
+    // deadline passes or the queue is closed.
+    bool waitForItems(size_t min_items, std::chrono::steady_clock::time_point deadline) {
+        while (size() < min_items && !closed_.load(std::memory_order_acquire)) {
+            std::unique_lock<std::mutex> lock(wait_mutex_);
+            consumer_waiting_.store(true, std::memory_order_seq_cst);
+            if (size() < min_items && !closed_.load(std::memory_order_acquire)) {
+                auto wake = std::min(deadline, std::chrono::steady_clock::now() + std::chrono::milliseconds(10));
+                data_cv_.wait_until(lock, wake);
+            }
+            consumer_waiting_.store(false, std::memory_order_seq_cst);
+            if (std::chrono::steady_clock::now() >= deadline) break;
+        }
+        return size() >= min_items;
+    }
+
+    // Wakes every waiter; blocked and later pushes fail. A push that
+    // already passed the closed check may still land.
+    void close() {
+        closed_.store(true, std::memory_order_release);
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+        space_cv_.notify_all();
+        data_cv_.notify_all();
+    }
+
+    // Re-arms a closed queue; nothing may be blocked on it
+    void reopen() {
+        closed_.store(false, std::memory_order_release);
+    }
+
+    bool closed() const {
+        return closed_.load(std::memory_order_acquire);
+    }
+
+    size_t size() const {
+        size_t head = dequeue_pos_.load(std::memory_order_acquire);
+        size_t tail = enqueue_pos_.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    size_t capacity() const {
+        return mask_ + 1;
+    }
+
+    Stats stats() const {
+        return {
+            size(),
+            capacity(),
+            enqueued_.load(std::memory_order_relaxed),
+            rejected_.load(std::memory_order_relaxed),
+            dropped_.load(std::memory_order_relaxed),
+            stalls_.load(std::memory_order_relaxed),
+            stall_ns_.load(std::memory_order_relaxed)
+        };
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_;
+
+    alignas(64) std::atomic<size_t> enqueue_pos_{0};
+    alignas(64) std::atomic<size_t> dequeue_pos_{0};
+
+    alignas(64) std::atomic<uint64_t> enqueued_{0};
+    std::atomic<uint64_t> rejected_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> stalls_{0};
+    std::atomic<uint64_t> stall_ns_{0};
+
+    std::atomic<bool> closed_{false};
+    std::atomic<int> producers_waiting_{0};
+    std::atomic<bool> consumer_waiting_{false};
+    std::mutex wait_mutex_;
+    std::condition_variable space_cv_;
+    std::condition_variable data_cv_;
+
+    bool tryPush(T& item, uint64_t* ticket) {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells_[pos & mask_];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->value = std::move(item);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        enqueued_.fetch_add(1, std::memory_order_relaxed);
+        if (ticket) *ticket = pos;
+
+        if (consumer_waiting_.load(std::memory_order_seq_cst)) {
+            std::lock_guard<std::mutex> lock(wait_mutex_);
+            data_cv_.notify_one();
+        }
+        return true;
+    }
+};
@@ -0,0 +1,113 @@
+#include "storage/bulk_indexer.h"
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+namespace {
+
+void usage(const char* argv0) {
+    std::cerr << "Usage: " << argv0 << " [options] <input> <output_dir>\n"
+              << "  --format pages|warc   input format (default: from extension)\n"
+              << "  --threads N           indexing threads (default: all cores)\n"
+              << "  --run-memory MB       per-thread run budget before spilling (default: 256)\n"
+              << "  --fan-in N            maximum runs per merge (default: 64)\n"
+              << "  --tmp DIR             directory for run files (default: output_dir)\n"
+              << "  --stopwords           leave stopwords out of the index\n"
+              << "  --language CODE       stopword language: en, fr, de or es (default: en)\n"
+              << "  --stem                index Porter2 stems of the terms\n"
+              << "  --reorder             reassign doc ids by graph bisection before each run is written\n"
+              << "The server must analyze queries with the same settings.\n";
+}
+
+bool endsWith(const std::string& s, const std::string& suffix) {
+    return s.size() >= suffix.size() && s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    BulkIndexer::Options options;
+    std::string format;
+    std::string input;
+    std::string output;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (arg == "--format" && has_value) {
+            format = argv[++i];
+        } else if (arg == "--threads" && has_value) {
+            options.threads = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--run-memory" && has_value) {
+            options.run_memory_bytes = std::strtoull(argv[++i], nullptr, 10) << 20;
+        } else if (arg == "--fan-in" && has_value) {
+            options.merge_fan_in = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--tmp" && has_value) {
+            options.tmp_dir = argv[++i];
+        } else if (arg == "--stopwords") {
+            options.analysis.stopwords = true;
+        } else if (arg == "--language" && has_value) {
+            options.analysis.language = Analyzer::language(argv[++i]);
+        } else if (arg == "--stem") {
+            options.analysis.stem = true;
+        } else if (arg == "--reorder") {
+            options.reorder = true;
+        } else if (input.empty() && arg[0] != '-') {
+            input = arg;
+        } else if (output.empty() && arg[0] != '-') {
+            output = arg;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (input.empty() || output.empty()) {
+        usage(argv[0]);
+        return 2;
+    }
+    if (format.empty()) {
+        format = endsWith(input, ".warc") ? "warc" : "pages";
+    }
+    if (format != "pages" && format != "warc") {
+        usage(argv[0]);
+        return 2;
+    }
+
+    try {
+        std::ifstream in(input, std::ios::binary);
+        if (!in) {
+            std::cerr << "Cannot open " << input << ": " << std::strerror(errno) << std::endl;
+            return 1;
+        }
+
+        BulkIndexer indexer(output, options);
+        auto add = [&indexer](CrawlDump::Page&& page) { indexer.add(std::move(page)); };
+        if (format == "warc") {
+            CrawlDump::readWarc(in, add);
+        } else {
+            CrawlDump::readPages(in, add);
+        }
+
+        auto report = indexer.finish();
+        std::cout << "Indexed " << report.documents << " documents ("
+                  << report.duplicates << " duplicate URLs skipped)\n"
+                  << "Runs merged: " << report.runs << "\n"
+                  << "Segment size: " << report.segment_bytes / 1024 << " KB\n"
+                  << "Elapsed: " << report.seconds << " s, "
+                  << static_cast<size_t>(report.docs_per_second) << " docs/sec\n"
+                  << "Peak RSS: " << report.peak_rss_bytes / (1024 * 1024) << " MB" << std::endl;
+        if (options.reorder) {
+            const auto& reorder = report.reorder;
+            std::cout << "Reorder: " << reorder.bits_before << " -> " << reorder.bits_after
+                      << " bits per posting over " << reorder.postings << " postings, "
+                      << reorder.seconds << " s" << std::endl;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Bulk indexing failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+"""Generates src/text/unicode_data.h from Python's unicodedata module.
+
+    python3 tools/gen_unicode_tables.py > src/text/unicode_data.h
+
+Per codepoint the tokenizer needs a class, a simple case folding and,
+when normalizing, an NFKC compatibility mapping. Classes and foldings
+are stored as a two-stage table: a block index per 128 codepoints into
+deduplicated 128-entry blocks of property ids, so the large uniform
+ranges (CJK, Hangul, unassigned planes) cost one shared block each.
+"""
+
+import sys
+import unicodedata
+
+BLOCK_BITS = 7
+BLOCK = 1 << BLOCK_BITS
+LIMIT = 0x40000          # everything above is unassigned, private or tags
+MAX_MAPPING = 4          # longer compatibility mappings are left alone
+
+OTHER, WORD, MARK, IDEOGRAPH = 0, 1, 2, 3
+
+
+def char_class(cp):
+    c = chr(cp)
+    category = unicodedata.category(c)
+    name = unicodedata.name(c, "")
+    if name.startswith(("CJK UNIFIED IDEOGRAPH", "CJK COMPATIBILITY IDEOGRAPH")) \
+            or (category == "Lo" and name.startswith("HIRAGANA")):
+        return IDEOGRAPH
+    if category[0] == "L" or category == "Nd" or c == "'":
+        return WORD
+    if category[0] == "M":
+        return MARK
+    return OTHER
+
+
+def simple_fold(cp):
+    """CaseFolding.txt statuses C and S: one codepoint in, one out."""
+    c = chr(cp)
+    for folded in (c.casefold(), c.lower()):
+        if len(folded) == 1:
+            return ord(folded)
+    return cp
+
+
+def compat_mapping(cp):
+    c = chr(cp)
+    if c == "’":                      # typographic apostrophe
+        return [ord("'")]
+    mapped = unicodedata.normalize("NFKC", c)
+    if mapped == c or len(mapped) > MAX_MAPPING:
+        return None
+    return [ord(m) for m in mapped]
+
+
+def compositions():
+    """Canonical pairs NFC composes: (starter, mark) -> precomposed."""
+    pairs = []
+    for cp in range(LIMIT):
+        decomposition = unicodedata.decomposition(chr(cp))
+        if not decomposition or decomposition.startswith("<"):
+            continue
+        parts = [int(p, 16) for p in decomposition.split()]
+        if len(parts) != 2:
+            continue
+        if unicodedata.normalize("NFC", chr(parts[0]) + chr(parts[1])) != chr(cp):
+            continue                       # composition exclusion
+        pairs.append((parts[0], parts[1], cp))
+    return sorted(pairs)
+
+
+def main():
+    properties = []                        # (class, fold delta, has mapping)
+    property_ids = {}
+    blocks = []
+    block_ids = {}
+    stage1 = []
+    mappings = []
+
+    for base in range(0, LIMIT, BLOCK):
+        block = []
+        for cp in range(base, base + BLOCK):
+            mapping = compat_mapping(cp)
+            if mapping is not None:
+                mappings.append((cp, mapping))
+            key = (char_class(cp), simple_fold(cp) - cp, mapping is not None)
+            if key not in property_ids:
+                property_ids[key] = len(properties)
+                properties.append(key)
+            block.append(property_ids[key])
+        block = tuple(block)
+        if block not in block_ids:
+            block_ids[block] = len(blocks)
+            blocks.append(block)
+        stage1.append(block_ids[block])
+
+    assert len(properties) <= 256 and len(blocks) <= 65536
+    pairs = compositions()
+
+    out = sys.stdout
+    out.write("#pragma once\n\n")
+    out.write("// Generated by tools/gen_unicode_tables.py from Unicode %s; do not edit.\n\n"
+              % unicodedata.unidata_version)
+    out.write("#include <cstdint>\n\n")
+    out.write("struct UnicodeData {\n")
+    out.write("    struct Property {\n        uint8_t cls;\n        bool mapped;\n"
+              "        int32_t fold_delta;\n    };\n\n")
+    out.write("    static constexpr uint32_t kLimit = 0x%x;\n" % LIMIT)
+    out.write("    static constexpr uint32_t kBlockBits = %d;\n" % BLOCK_BITS)
+    out.write("    static constexpr uint32_t kMaxMapping = %d;\n\n" % MAX_MAPPING)
+
+    out.write("    static constexpr Property kProperties[%d] = {\n" % len(properties))
+    for cls, delta, mapped in properties:
+        out.write("        {%d, %s, %d},\n" % (cls, "true" if mapped else "false", delta))
+    out.write("    };\n\n")
+
+    def array(decl, values, per_line):
+        out.write("    static constexpr %s = {\n" % decl)
+        for i in range(0, len(values), per_line):
+            out.write("        " + ", ".join(str(v) for v in values[i:i + per_line]) + ",\n")
+        out.write("    };\n\n")
+
+    array("uint16_t kStage1[%d]" % len(stage1), stage1, 24)
+    array("uint8_t kStage2[%d]" % (len(blocks) * BLOCK),
+          [p for block in blocks for p in block], 32)
+
+    # Mappings: sorted codepoints, offsets into one flat target array
+    targets = []
+    offsets = []
+    for _, mapping in mappings:
+        offsets.append(len(targets))
+        targets.extend(mapping)
+    offsets.append(len(targets))
+    array("uint32_t kMappedCodepoints[%d]" % len(mappings), [cp for cp, _ in mappings], 12)
+    array("uint16_t kMappingOffsets[%d]" % len(offsets), offsets, 16)
+    array("uint32_t kMappingTargets[%d]" % len(targets), targets, 12)
+
+    array("uint64_t kCompositionKeys[%d]" % len(pairs),
+          ["0x%xull" % (a << 21 | b) for a, b, _ in pairs], 6)
+    array("uint32_t kCompositions[%d]" % len(pairs), [c for _, _, c in pairs], 12)
+    out.write("};\n")
+
+
+if __name__ == "__main__":
+    main()
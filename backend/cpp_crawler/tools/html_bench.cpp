@@ -0,0 +1,209 @@
+#include "text/html_tokenizer.h"
+#include "text/page_extractor.h"
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+void usage(const char* argv0) {
+    std::cerr << "Usage: " << argv0 << " [options] [page.html...]\n"
+              << "  --pages N         synthetic pages when no files are given (default: 500)\n"
+              << "  --rounds N        timed passes over the pages (default: 5)\n"
+              << "  --regex-pages N   pages for the std::regex baseline, 0 to skip (default: 20)\n";
+}
+
+// A page shaped like a typical article: head metadata, inline script and
+// style, navigation links, paragraphs with entities and inline markup
+std::string syntheticPage(std::mt19937& rng) {
+    static const char* const kWords[] = {
+        "search", "engine", "index", "crawler", "page", "results", "query", "rank",
+        "the", "of", "a", "and", "links", "text", "caf&eacute;", "&amp;"
+    };
+    auto sentence = [&](int words) {
+        std::string s;
+        for (int i = 0; i < words; ++i) {
+            if (i) s += ' ';
+            s += kWords[rng() % 16];
+        }
+        return s;
+    };
+
+    std::string html = "<!DOCTYPE html>\n<html lang=\"en\"><head><meta charset=\"utf-8\">"
+        "<title>" + sentence(6) + "</title>\n"
+        "<meta name=\"description\" content=\"" + sentence(20) + "\">\n"
+        "<meta property=\"og:title\" content=\"" + sentence(5) + "\">\n"
+        "<style>body { font: 14px sans-serif; } .nav > a { color: #333; }</style>\n"
+        "<script>window.dataLayer = []; if (a < b && c > d) { track('<div>'); }</script>\n"
+        "</head><body><nav class=\"nav\">";
+    for (int i = 0; i < 30; ++i) {
+        html += "<a href=\"/section/" + std::to_string(rng() % 1000) + "\" class=\"nav-link\">" +
+            sentence(2) + "</a> ";
+    }
+    html += "</nav>\n<main><article>";
+    for (int p = 0; p < 25; ++p) {
+        html += "<p>" + sentence(30) + " <a href=\"https://example.org/" + std::to_string(rng()) +
+            "\">" + sentence(3) + "</a> <b>" + sentence(4) + "</b> " + sentence(20) + "</p>\n";
+        if (p % 8 == 0) html += "<!-- ad slot " + std::to_string(p) + " -->\n";
+    }
+    html += "</article></main><footer><p>&copy; 2024 " + sentence(5) + "</p></footer>"
+        "<script src=\"/app.js\" async></script></body></html>\n";
+    return html;
+}
+
+// The fields HTMLParser used to get with one std::regex pass each
+struct Extracted {
+    std::string title;
+    std::string description;
+    std::vector<std::string> links;
+    std::string text;
+
+    void clear() {
+        title.clear();
+        description.clear();
+        links.clear();
+        text.clear();
+    }
+};
+
+void extractWithRegex(const std::string& html, Extracted& page) {
+    page.clear();
+    std::smatch match;
+    if (std::regex_search(html, match, std::regex("<title[^>]*>([^<]*)</title>", std::regex::icase))) {
+        page.title = match[1].str();
+    }
+    std::regex meta("<meta[^>]*name=[\"']description[\"'][^>]*content=[\"']([^\"']*)[\"'][^>]*>",
+                    std::regex::icase);
+    if (std::regex_search(html, match, meta)) {
+        page.description = match[1].str();
+    }
+    std::regex link("<a[^>]*href=[\"']([^\"']*)[\"'][^>]*>", std::regex::icase);
+    for (std::sregex_iterator it(html.begin(), html.end(), link), end; it != end; ++it) {
+        page.links.push_back((*it)[1].str());
+    }
+    size_t body = html.find("<body");
+    std::string content = body == std::string::npos ? "" : html.substr(body);
+    content = std::regex_replace(content, std::regex("<script[^>]*>[\\s\\S]*?</script>", std::regex::icase), "");
+    content = std::regex_replace(content, std::regex("<style[^>]*>[\\s\\S]*?</style>", std::regex::icase), "");
+    page.text = std::regex_replace(content, std::regex("<[^>]*>"), " ");
+    for (const char* entity : {"&amp;", "&lt;", "&gt;", "&quot;", "&#39;", "&nbsp;", "&copy;"}) {
+        page.text = std::regex_replace(page.text, std::regex(entity), " ");
+    }
+}
+
+template <typename F>
+double seconds(F&& f) {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void report(const char* name, size_t bytes, size_t pages, double elapsed) {
+    std::cout << name << ": " << bytes / elapsed / 1e6 << " MB/s, "
+              << pages / elapsed << " pages/s\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t page_count = 500;
+    int rounds = 5;
+    size_t regex_pages = 20;
+    std::vector<std::string> pages;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (arg == "--pages" && has_value) {
+            page_count = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--rounds" && has_value) {
+            rounds = std::atoi(argv[++i]);
+        } else if (arg == "--regex-pages" && has_value) {
+            regex_pages = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg[0] != '-') {
+            std::ifstream in(arg, std::ios::binary);
+            if (!in) {
+                std::cerr << "Cannot read " << arg << "\n";
+                return 1;
+            }
+            std::stringstream contents;
+            contents << in.rdbuf();
+            pages.push_back(contents.str());
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (rounds <= 0 || (pages.empty() && page_count == 0)) {
+        usage(argv[0]);
+        return 2;
+    }
+    if (pages.empty()) {
+        std::mt19937 rng(42);
+        for (size_t i = 0; i < page_count; ++i) pages.push_back(syntheticPage(rng));
+    }
+
+    size_t bytes = 0;
+    for (const auto& page : pages) bytes += page.size();
+    std::cout << pages.size() << " pages, " << bytes / 1e6 << " MB\n";
+
+    HtmlTokenizer tokens;
+    size_t events = 0;
+    double elapsed = seconds([&] {
+        for (int round = 0; round < rounds; ++round) {
+            for (const auto& page : pages) {
+                tokens.reset(page);
+                while (tokens.next()) events++;
+            }
+        }
+    });
+    report("tokenize", bytes * rounds, pages.size() * rounds, elapsed);
+    std::cout << "          " << events / rounds / pages.size() << " tokens per page, "
+              << events / elapsed / 1e6 << " M tokens/s\n";
+
+    PageExtractor extractor;
+    ExtractedPage extracted;
+    size_t links = 0;
+    size_t words = 0;
+    elapsed = seconds([&] {
+        for (int round = 0; round < rounds; ++round) {
+            for (const auto& html : pages) {
+                extractor.extract(html, extracted);
+                links += extracted.links.size();
+                words += extracted.tokens.size();
+            }
+        }
+    });
+    report("extract ", bytes * rounds, pages.size() * rounds, elapsed);
+    std::cout << "          " << links / rounds / pages.size() << " links, "
+              << words / rounds / pages.size() << " tokens per page\n";
+
+    regex_pages = std::min(regex_pages, pages.size());
+    if (regex_pages > 0) {
+        size_t regex_bytes = 0;
+        size_t regex_links = 0;
+        size_t extractor_links = 0;
+        Extracted page;
+        elapsed = seconds([&] {
+            for (size_t i = 0; i < regex_pages; ++i) {
+                extractWithRegex(pages[i], page);
+                regex_bytes += pages[i].size();
+                regex_links += page.links.size();
+            }
+        });
+        for (size_t i = 0; i < regex_pages; ++i) {
+            extractor.extract(pages[i], extracted);
+            extractor_links += extracted.links.size();
+        }
+        report("regex   ", regex_bytes, regex_pages, elapsed);
+        std::cout << "          links found: " << regex_links << " by regex, "
+                  << extractor_links << " by the extractor\n";
+    }
+    return 0;
+}
@@ -0,0 +1,167 @@
+#include "text/parser.h"
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+void usage(const char* argv0) {
+    std::cerr << "Usage: " << argv0 << " [options] [file...]\n"
+              << "  --megabytes N   corpus size, files repeated or synthetic text (default: 64)\n"
+              << "  --no-normalize  skip NFKC-lite normalization\n"
+              << "  --rounds N      timed passes over the corpus (default: 10)\n";
+}
+
+// Word-like text with mixed case, digits and punctuation, roughly the
+// shape of extracted page text: ASCII only, or a mix of scripts
+std::string syntheticText(size_t bytes, bool multilingual) {
+    static const char* const kAscii[] = {
+        "the", "Search", "engine", "INDEX", "crawler", "don't", "2024", "page",
+        "results", "of", "a", "Query", "html5", "and", "links", "rank"
+    };
+    static const char* const kMultilingual[] = {
+        "the", "Suche", "Straße", "école", "Café", "Москва", "поиск", "Αθήνα",
+        "東京", "検索エンジン", "हिन्दी", "índice", "ｆｕｌｌ", "naïve", "2024", "página"
+    };
+    static const char* const kSeparators[] = {" ", " ", " ", ", ", ". ", "\n", " - ", "; "};
+    const char* const* words = multilingual ? kMultilingual : kAscii;
+    std::mt19937 rng(42);
+    std::string text;
+    text.reserve(bytes + 32);
+    while (text.size() < bytes) {
+        text += words[rng() % 16];
+        text += kSeparators[rng() % 8];
+    }
+    return text;
+}
+
+// The byte-at-a-time definition forEachToken must agree with on ASCII
+// text; returns the token bytes, lowercased, one per line
+std::string referenceTokens(const std::string& text) {
+    std::string tokens;
+    bool in_token = false;
+    for (unsigned char c : text) {
+        bool upper = c >= 'A' && c <= 'Z';
+        bool token = upper || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '\'';
+        if (token) {
+            tokens.push_back(static_cast<char>(upper ? c + 32 : c));
+        } else if (in_token) {
+            tokens.push_back('\n');
+        }
+        in_token = token;
+    }
+    if (in_token) tokens.push_back('\n');
+    return tokens;
+}
+
+bool isAscii(const std::string& text) {
+    for (unsigned char c : text) {
+        if (c >= 0x80) return false;
+    }
+    return true;
+}
+
+// Token bytes are summed so the callback cannot be optimized away;
+// returns GB/s
+double measure(const char* name, const std::string& text, int rounds,
+               TextParser::Normalization normalization) {
+    std::string folded;
+    size_t tokens = 0;
+    size_t checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; ++round) {
+        tokens = TextParser::forEachToken(text, folded, [&checksum](std::string_view token, size_t) {
+            checksum += token.size();
+        }, normalization);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    double bytes = static_cast<double>(text.size()) * rounds;
+    std::cout << name << ": " << text.size() / 1e6 << " MB, " << tokens << " tokens, "
+              << bytes / seconds / 1e9 << " GB/s, "
+              << tokens * rounds / seconds / 1e6 << " M tokens/s (checksum " << checksum << ")\n";
+    return bytes / seconds / 1e9;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t megabytes = 64;
+    int rounds = 10;
+    std::vector<std::string> files;
+    auto normalization = TextParser::Normalization::NfkcLite;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (arg == "--megabytes" && has_value) {
+            megabytes = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--rounds" && has_value) {
+            rounds = std::atoi(argv[++i]);
+        } else if (arg == "--no-normalize") {
+            normalization = TextParser::Normalization::None;
+        } else if (arg[0] != '-') {
+            files.push_back(arg);
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (megabytes == 0 || rounds <= 0) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    std::string text;
+    std::string folded;
+    for (const auto& file : files) {
+        std::ifstream in(file, std::ios::binary);
+        if (!in) {
+            std::cerr << "Cannot read " << file << "\n";
+            return 1;
+        }
+        std::stringstream contents;
+        contents << in.rdbuf();
+        text += contents.str();
+    }
+    std::vector<std::pair<const char*, std::string>> corpora;
+    if (text.empty()) {
+        corpora.emplace_back("ascii", syntheticText(megabytes << 20, false));
+        corpora.emplace_back("multilingual", syntheticText(megabytes << 20, true));
+    } else {
+        while (text.size() < (megabytes << 20)) text += text;
+        corpora.emplace_back("files", std::move(text));
+    }
+
+    std::cout << "path: " << TextParser::foldingPath() << "\n";
+    std::vector<double> throughputs;
+    for (const auto& [name, corpus] : corpora) {
+        if (isAscii(corpus)) {
+            std::string tokens;
+            TextParser::forEachToken(corpus, folded, [&tokens](std::string_view token, size_t) {
+                tokens.append(token.data(), token.size());
+                tokens.push_back('\n');
+            }, normalization);
+            if (tokens != referenceTokens(corpus)) {
+                std::cerr << "Mismatch against the reference tokenizer on " << name << "\n";
+                return 1;
+            }
+        }
+        throughputs.push_back(measure(name, corpus, rounds, normalization));
+    }
+
+    // The goal is multilingual text within 20% of ASCII. It is not met:
+    // the SIMD blocks only classify ASCII, and mixed-script text goes
+    // through the codepoint path one codepoint at a time.
+    if (throughputs.size() == 2) {
+        double ratio = throughputs[1] / throughputs[0];
+        std::cout << "multilingual/ascii: " << ratio << " (target 0.8, "
+                  << (ratio >= 0.8 ? "met" : "NOT met") << ")\n";
+    }
+    return 0;
+}
@@ -0,0 +1,166 @@
+#include "net/url.h"
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace {
+
+void usage(const char* argv0) {
+    std::cerr << "Usage: " << argv0 << " [options] [links.txt]\n"
+              << "  --links N    synthetic links when no file is given (default: 1000000)\n"
+              << "  --rounds N   timed passes over the links (default: 5)\n"
+              << "A links file holds one \"base reference\" pair per line.\n";
+}
+
+// RFC 3986 section 5.4 examples, canonicalized: no fragment
+bool checkExamples() {
+    static const std::pair<const char*, const char*> kExamples[] = {
+        {"g:h", ""}, {"g", "http://a/b/c/g"}, {"./g", "http://a/b/c/g"},
+        {"g/", "http://a/b/c/g/"}, {"/g", "http://a/g"}, {"//g", "http://g/"},
+        {"?y", "http://a/b/c/d;p?y"}, {"g?y", "http://a/b/c/g?y"}, {"#s", "http://a/b/c/d;p?q"},
+        {"g#s", "http://a/b/c/g"}, {"g?y#s", "http://a/b/c/g?y"}, {";x", "http://a/b/c/;x"},
+        {"g;x", "http://a/b/c/g;x"}, {"g;x?y#s", "http://a/b/c/g;x?y"}, {"", "http://a/b/c/d;p?q"},
+        {".", "http://a/b/c/"}, {"./", "http://a/b/c/"}, {"..", "http://a/b/"},
+        {"../", "http://a/b/"}, {"../g", "http://a/b/g"}, {"../..", "http://a/"},
+        {"../../", "http://a/"}, {"../../g", "http://a/g"}, {"../../../g", "http://a/g"},
+        {"../../../../g", "http://a/g"}, {"/./g", "http://a/g"}, {"/../g", "http://a/g"},
+        {"g.", "http://a/b/c/g."}, {".g", "http://a/b/c/.g"}, {"g..", "http://a/b/c/g.."},
+        {"..g", "http://a/b/c/..g"}, {"./../g", "http://a/b/g"}, {"./g/.", "http://a/b/c/g/"},
+        {"g/./h", "http://a/b/c/g/h"}, {"g/../h", "http://a/b/c/h"},
+        {"g;x=1/./y", "http://a/b/c/g;x=1/y"}, {"g;x=1/../y", "http://a/b/c/y"},
+        {"HTTP://A:80/%7Eb/./d/%2e%2E/c?utm_source=x&z=1&y=2#f", "http://a/~b/c?y=2&z=1"},
+    };
+    bool ok = true;
+    std::string out;
+    for (const auto& [reference, expected] : kExamples) {
+        std::string result = Url::resolve("http://a/b/c/d;p?q", reference, out) ? out : "";
+        if (result != expected) {
+            std::cerr << "\"" << reference << "\" resolved to \"" << result << "\", expected \""
+                      << expected << "\"\n";
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+// Page URLs and the shapes of href found on them: relative paths, dot
+// segments, root-relative and protocol-relative links, absolute links
+// with mixed case, default ports, fragments and tracking parameters
+std::vector<std::pair<std::string, std::string>> syntheticLinks(size_t count) {
+    static const char* const kHosts[] = {"example.com", "News.Example.org", "blog.example.net:8080"};
+    static const char* const kSegments[] = {"articles", "2024", "search", "index.html", "a%7eb", "tag"};
+    std::mt19937 rng(42);
+    auto path = [&](int depth) {
+        std::string p;
+        for (int i = 0; i < depth; ++i) {
+            if (i) p += '/';
+            p += kSegments[rng() % 6];
+        }
+        return p;
+    };
+
+    std::vector<std::pair<std::string, std::string>> links;
+    links.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        std::string base = std::string("https://") + kHosts[rng() % 3] + "/" + path(3);
+        std::string href;
+        switch (rng() % 8) {
+            case 0: href = path(1); break;
+            case 1: href = "../" + path(2); break;
+            case 2: href = "/" + path(2) + "?page=" + std::to_string(rng() % 50); break;
+            case 3: href = "//cdn.example.com/" + path(2); break;
+            case 4: href = "#section-" + std::to_string(rng() % 9); break;
+            case 5: href = "HTTPS://Example.COM:443/" + path(3) + "#top"; break;
+            case 6: href = "?utm_source=feed&utm_medium=rss&id=" + std::to_string(rng() % 1000); break;
+            default: href = "./" + path(1) + "/./" + path(1) + "?b=2&a=1&fbclid=x"; break;
+        }
+        links.emplace_back(std::move(base), std::move(href));
+    }
+    return links;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t link_count = 1000000;
+    int rounds = 5;
+    std::string file;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+        if (arg == "--links" && has_value) {
+            link_count = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--rounds" && has_value) {
+            rounds = std::atoi(argv[++i]);
+        } else if (arg[0] != '-') {
+            file = arg;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (rounds <= 0 || (file.empty() && link_count == 0)) {
+        usage(argv[0]);
+        return 2;
+    }
+    if (!checkExamples()) {
+        std::cerr << "Resolution differs from RFC 3986\n";
+        return 1;
+    }
+
+    std::vector<std::pair<std::string, std::string>> links;
+    if (file.empty()) {
+        links = syntheticLinks(link_count);
+    } else {
+        std::ifstream in(file);
+        if (!in) {
+            std::cerr << "Cannot read " << file << "\n";
+            return 1;
+        }
+        std::string base;
+        std::string reference;
+        while (in >> base && std::getline(in >> std::ws, reference)) {
+            links.emplace_back(base, reference);
+        }
+    }
+
+    std::string out;
+    size_t resolved = 0;
+    size_t bytes = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; ++round) {
+        for (const auto& [base, reference] : links) {
+            if (Url::resolve(base, reference, out)) {
+                resolved++;
+                bytes += out.size();
+            }
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::unordered_set<std::string> distinct;
+    size_t raw_distinct = 0;
+    {
+        std::unordered_set<std::string> raw;
+        for (const auto& [base, reference] : links) {
+            raw.insert(base + " " + reference);
+            if (Url::resolve(base, reference, out)) distinct.insert(out);
+        }
+        raw_distinct = raw.size();
+    }
+
+    size_t total = links.size() * rounds;
+    std::cout << links.size() << " links, " << resolved / rounds << " resolved (checksum " << bytes << ")\n"
+              << "resolve: " << total / seconds / 1e6 << " M URLs/s, "
+              << seconds * 1e9 / total << " ns per URL\n"
+              << "distinct: " << raw_distinct << " (base, href) pairs, " << distinct.size()
+              << " canonical URLs\n";
+    return 0;
+}